@@ -21,6 +21,7 @@
 %ignore vrv::Toolkit::PrintOptionUsage;
 %ignore vrv::Toolkit::GetHumdrum;
 %ignore vrv::Toolkit::RenderToDeviceContext;
+%ignore vrv::Toolkit::RenderToSVGPages;
 %ignore vrv::EnableLogToBuffer;
 
 %feature("autodoc", "1");
@@ -59,6 +60,20 @@ def getDefaultOptions(self) -> dict:
     return json.loads($action(self))
 %}
 
+// Toolkit::GetLogEntries
+%feature("shadow") vrv::Toolkit::GetLogEntries() %{
+def getLogEntries(self) -> list:
+    """Return the log entries for the latest operation."""
+    return json.loads($action(self))
+%}
+
+// Toolkit::GetProfile
+%feature("shadow") vrv::Toolkit::GetProfile() %{
+def getProfile(self) -> list:
+    """Return the profile collected since the last call."""
+    return json.loads($action(self))
+%}
+
 // Toolkit::GetDescriptiveFeatures
 %feature("shadow") vrv::Toolkit::GetDescriptiveFeatures(const std::string &) %{
 def getDescriptiveFeatures(self, options: Optional[dict] = None) -> dict:
@@ -82,6 +97,13 @@ def getElementsAtTime(self, millisec: int) -> dict:
     return json.loads($action(self, millisec))
 %}
 
+// Toolkit::GetElementsAtTimeRange
+%feature("shadow") vrv::Toolkit::GetElementsAtTimeRange(int, int) %{
+def getElementsAtTimeRange(self, millisecStart: int, millisecEnd: int) -> list:
+    """Return the changes of the elements being played within a time range."""
+    return json.loads($action(self, millisecStart, millisecEnd))
+%}
+
 // Toolkit::GetExpansionIdsForElement
 %feature("shadow") vrv::Toolkit::GetExpansionIdsForElement(const std::string &) %{
 def getExpansionIdsForElement(self, xmlId: str) -> dict:
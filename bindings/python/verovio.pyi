@@ -15,6 +15,8 @@ class toolkit:
     def getResourcePath(self) -> str: ...
     def setResourcePath(self, path: str) -> None: ...
     def getLog(self) -> str: ...
+    def getLogEntries(self) -> list: ...
+    def getProfile(self) -> list: ...
     def getVersion(self) -> str: ...
     def resetXmlIdSeed(self, seed: int) -> None: ...
     def loadFile(self, filename: str) -> bool: ...
@@ -38,6 +40,7 @@ class toolkit:
     def editInfo(self) -> dict: ...
     def renderData(self, data: str, options: dict) -> str: ...
     def renderToSVG(self, pageNo: int = 1, xmlDeclaration: bool = False) -> str: ...
+    def renderToSVGRange(self, pageNo: int, x1: int, x2: int, xmlDeclaration: bool = False) -> str: ...
     def renderToSVGFile(self, filename, pageNo: int = 1) -> bool: ...
     def renderToMIDI(self) -> str: ...
     def renderToMIDIFile(self, filename: str) -> bool: ...
@@ -55,6 +58,7 @@ class toolkit:
     def saveFile(self, filename: str, options: dict | None = None) -> bool: ...
     def getDescriptiveFeatures(self, options: dict | None = None) -> dict: ...
     def getElementsAtTime(self, millisec: int) -> dict: ...
+    def getElementsAtTimeRange(self, millisecStart: int, millisecEnd: int) -> list: ...
     def getPageWithElement(self, xmlId: str) -> int: ...
     def getElementAttr(self, xmlId: str) -> dict: ...
     def getNotatedIdForElement(self, xmlId: str) -> str: ...
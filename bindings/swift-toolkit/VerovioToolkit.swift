@@ -74,6 +74,12 @@ public class VerovioToolkit {
         return String(cString: cStr)
     }
     
+    public func getElementsAtTimeRange(_ millisecStart: Int, _ millisecEnd: Int) -> String {
+        guard let tk = toolkitPtr else { return "" }
+        guard let cStr = vrvToolkit_getElementsAtTimeRange(tk, Int32(millisecStart), Int32(millisecEnd)) else { return "" }
+        return String(cString: cStr)
+    }
+    
     public func getExpansionIdsForElement(_ xmlId: String) -> String {
         guard let tk = toolkitPtr else { return "" }
         return xmlId.withCString { cStr in
@@ -143,6 +149,18 @@ public class VerovioToolkit {
         return String(cString: cStr)
     }
 
+    public func getLogEntries() -> String {
+        guard let tk = toolkitPtr else { return "" }
+        guard let cStr = vrvToolkit_getLogEntries(tk) else { return "" }
+        return String(cString: cStr)
+    }
+
+    public func getProfile() -> String {
+        guard let tk = toolkitPtr else { return "" }
+        guard let cStr = vrvToolkit_getProfile(tk) else { return "" }
+        return String(cString: cStr)
+    }
+
     public func getMEI(_ options: String) -> String {
         guard let tk = toolkitPtr else { return "" }
         return options.withCString { cStr in
@@ -314,6 +332,12 @@ public class VerovioToolkit {
         return String(cString: cStr)
     }
     
+    public func renderToSVGRange(_ pageNo: Int, _ x1: Int, _ x2: Int, _ xmlDeclaration: Bool) -> String {
+        guard let tk = toolkitPtr else { return "" }
+        guard let cStr = vrvToolkit_renderToSVGRange(tk, Int32(pageNo), Int32(x1), Int32(x2), xmlDeclaration) else { return "" }
+        return String(cString: cStr)
+    }
+    
     public func renderToSVGFile(_ filename: String, _ pageNo: Int) -> Bool {
         guard let tk = toolkitPtr else { return false }
         return filename.withCString { cStr in
@@ -39,6 +39,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *getElementsAtTime(Toolkit *ic, int time)
     mapping.getElementsAtTime = VerovioModule.cwrap("vrvToolkit_getElementsAtTime", "string", ["number", "number"]);
 
+    // char *getElementsAtTimeRange(Toolkit *ic, int start, int end)
+    mapping.getElementsAtTimeRange = VerovioModule.cwrap("vrvToolkit_getElementsAtTimeRange", "string", ["number", "number", "number"]);
+
     // char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId);
     mapping.getExpansionIdsForElement = VerovioModule.cwrap("vrvToolkit_getExpansionIdsForElement", "string", ["number", "string"]);
 
@@ -57,6 +60,12 @@ function getToolkitFunction(VerovioModule, method) {
     // char *getLog(Toolkit *ic)
     mapping.getLog = VerovioModule.cwrap("vrvToolkit_getLog", "string", ["number"]);
 
+    // char *getLogEntries(Toolkit *ic)
+    mapping.getLogEntries = VerovioModule.cwrap("vrvToolkit_getLogEntries", "string", ["number"]);
+
+    // char *getProfile(Toolkit *ic)
+    mapping.getProfile = VerovioModule.cwrap("vrvToolkit_getProfile", "string", ["number"]);
+
     // char *getMEI(Toolkit *ic, const char *options)
     mapping.getMEI = VerovioModule.cwrap("vrvToolkit_getMEI", "string", ["number", "string"]);
 
@@ -114,6 +123,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *renderToSvg(Toolkit *ic, int pageNo, int xmlDeclaration)
     mapping.renderToSVG = VerovioModule.cwrap("vrvToolkit_renderToSVG", "string", ["number", "number", "number"]);
 
+    // char *renderToSVGRange(Toolkit *ic, int pageNo, int x1, int x2, int xmlDeclaration)
+    mapping.renderToSVGRange = VerovioModule.cwrap("vrvToolkit_renderToSVGRange", "string", ["number", "number", "number", "number", "number"]);
+
     // char *renderToTimemap(Toolkit *ic)
     mapping.renderToTimemap = VerovioModule.cwrap("vrvToolkit_renderToTimemap", "string", ["number", "string"]);
 
@@ -46,6 +46,10 @@ export class VerovioToolkit {
         return JSON.parse(this.proxy.getElementsAtTime(this.ptr, millisec));
     }
 
+    getElementsAtTimeRange(millisecStart, millisecEnd) {
+        return JSON.parse(this.proxy.getElementsAtTimeRange(this.ptr, millisecStart, millisecEnd));
+    }
+
     getExpansionIdsForElement(xmlId) {
         return JSON.parse(this.proxy.getExpansionIdsForElement(this.ptr, xmlId));
     }
@@ -70,6 +74,14 @@ export class VerovioToolkit {
         return this.proxy.getLog(this.ptr);
     }
 
+    getLogEntries() {
+        return JSON.parse(this.proxy.getLogEntries(this.ptr));
+    }
+
+    getProfile() {
+        return JSON.parse(this.proxy.getProfile(this.ptr));
+    }
+
     getMEI(options = {}) {
         return this.proxy.getMEI(this.ptr, JSON.stringify(options));
     }
@@ -166,6 +178,10 @@ export class VerovioToolkit {
         return this.proxy.renderToSVG(this.ptr, pageNo, xmlDeclaration);
     }
 
+    renderToSVGRange(pageNo, x1, x2, xmlDeclaration = false) {
+        return this.proxy.renderToSVGRange(this.ptr, pageNo, x1, x2, xmlDeclaration);
+    }
+
     renderToTimemap(options = {}) {
         return JSON.parse(this.proxy.renderToTimemap(this.ptr, JSON.stringify(options)));
     }
@@ -8,6 +8,8 @@
 #ifndef __VRV_BOUNDING_BOX_H__
 #define __VRV_BOUNDING_BOX_H__
 
+#include <initializer_list>
+
 //----------------------------------------------------------------------------
 
 #include "vrvdef.h"
@@ -41,6 +43,8 @@ public:
     virtual ClassId GetClassId() const = 0;
     bool Is(ClassId classId) const { return (this->GetClassId() == classId); }
     bool Is(const std::vector<ClassId> &classIds) const;
+    // Overload for braced lists, e.g., Is({ NOTE, CHORD }), which avoids building a temporary vector
+    bool Is(std::initializer_list<ClassId> classIds) const;
     ///@}
 
     /**
@@ -81,9 +81,9 @@ protected:
 class ClassIdsComparison : public Comparison {
 
 public:
-    ClassIdsComparison(const std::vector<ClassId> &classIds)
+    ClassIdsComparison(std::vector<ClassId> classIds)
     {
-        m_classIds = classIds;
+        m_classIds = std::move(classIds);
         m_supportReverse = true;
     }
 
@@ -424,6 +424,26 @@ private:
     data_PGFUNC m_func;
 };
 
+//----------------------------------------------------------------------------
+// CrossStaffComparison
+//----------------------------------------------------------------------------
+
+/**
+ * This class evaluates if the object is a cross-staff note or chord
+ */
+class CrossStaffComparison : public Comparison {
+public:
+    CrossStaffComparison() = default;
+
+    bool operator()(const Object *object) override
+    {
+        if (!object->Is({ NOTE, CHORD })) return false;
+        const LayerElement *layerElement = vrv_cast<const LayerElement *>(object);
+        assert(layerElement);
+        return (layerElement->m_crossStaff != NULL);
+    }
+};
+
 //----------------------------------------------------------------------------
 // CrossAlignmentReferenceComparison
 //----------------------------------------------------------------------------
@@ -71,6 +71,56 @@ private:
     Page *m_page;
 };
 
+//----------------------------------------------------------------------------
+// ConvertToScoreBasedFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class copies a page-based document into a score-based tree of a target document.
+ * Milestone elements are turned back into containers and the copies keep the IDs of the original objects.
+ */
+class ConvertToScoreBasedFunctor : public ConstFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    ConvertToScoreBasedFunctor(Doc *targetDoc);
+    virtual ~ConvertToScoreBasedFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return false; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitDiv(const Div *div) override;
+    FunctorCode VisitDoc(const Doc *doc) override;
+    FunctorCode VisitObject(const Object *object) override;
+    FunctorCode VisitPage(const Page *page) override;
+    FunctorCode VisitPageMilestone(const PageMilestoneEnd *pageMilestoneEnd) override;
+    FunctorCode VisitPages(const Pages *pages) override;
+    FunctorCode VisitSystem(const System *system) override;
+    FunctorCode VisitSystemMilestone(const SystemMilestoneEnd *systemMilestoneEnd) override;
+    ///@}
+
+protected:
+    //
+private:
+    /** Set the IDs of the copy and of its descendants back to the ones of the original */
+    void RestoreIDs(const Object *object, Object *copy) const;
+
+public:
+    //
+private:
+    // The stack of containers in the target document
+    ArrayOfObjects m_containers;
+};
+
 //----------------------------------------------------------------------------
 // ConvertToCastOffMensuralFunctor
 //----------------------------------------------------------------------------
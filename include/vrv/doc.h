@@ -14,6 +14,7 @@
 #include "options.h"
 #include "resources.h"
 #include "scoredef.h"
+#include "timemap.h"
 
 namespace smf {
 class MidiFile;
@@ -85,6 +86,11 @@ public:
     void SetOptions(Options *options) { (*m_options) = *options; }
     ///@}
 
+    /**
+     * Getter for the profiler (NULL when profiling is disabled)
+     */
+    Profiler *GetProfiler() { return (m_options->m_profile.GetValue()) ? &m_profiler : NULL; }
+
     /**
      * Getter for the resources
      */
@@ -283,6 +289,12 @@ public:
      */
     bool HasTimemap() const;
 
+    /**
+     * Return the time index of the measures, notes and rests.
+     * The timemap is calculated and the index is built if necessary.
+     */
+    const TimemapIndex &GetTimemapIndex();
+
     /**
      * Export the document to a MIDI file.
      * Run trough all the layers and fill the MIDI file content.
@@ -375,6 +387,14 @@ public:
      */
     void ConvertToPageBasedDoc();
 
+    /**
+     * Copy the doc to an empty target doc as score-based MEI, as when loading the MEI output of the doc.
+     * Milestones are turned back to containers and the IDs of the copied objects are preserved.
+     * The target doc has to be converted to page-based MEI (e.g., after expansion) before being used.
+     * The header and the page dimensions of the scoreDef are copied but not the front and back text divs.
+     */
+    void CopyToScoreBasedDoc(Doc *targetDoc);
+
     /**
      * Convert mensural MEI into cast-off (measure) segments looking at the barLine objects.
      * Segment positions occur where a barLine is set on all staves.
@@ -538,6 +558,17 @@ public:
      */
     void RefreshLayout();
 
+    /**
+     * @name Methods for the ID index of the document.
+     * The index is kept up-to-date by Object when children are attached or detached and when ids are changed.
+     * GetIndexedObject returns the first object with the id and sets count to the number of objects having it.
+     */
+    ///@{
+    void IndexID(Object *object);
+    void UnindexID(Object *object);
+    const Object *GetIndexedObject(const std::string &id, int &count) const;
+    ///@}
+
     /**
      * Reset the document focus
      */
@@ -637,6 +668,9 @@ public:
     /** An expansion map that contains  */
     ExpansionMap m_expansionMap;
 
+    /** The profiler filled when the profile option is enabled */
+    Profiler m_profiler;
+
 private:
     /**
      * The type of document indicates how to deal with the layout information.
@@ -723,6 +757,12 @@ private:
      */
     double m_timemapTempo;
 
+    /**
+     * The time index built with the timemap.
+     * It is reset when the data preparation is redone since elements might have changed.
+     */
+    TimemapIndex m_timemapIndex;
+
     /**
      * A flag to indicate whereas the document contains analytical markup to be converted.
      * This is currently limited to @fermata and @tie. Other attribute markup (@accid and @artic)
@@ -757,6 +797,12 @@ private:
 
     /** Facsimile information */
     Facsimile *m_facsimile;
+
+    /**
+     * The index of all the objects in the tree by id.
+     * Duplicated ids are allowed and resolved by a traversal in Object::FindDescendantByID
+     */
+    MultiMapOfStrObjects m_idIndex;
 };
 
 } // namespace vrv
@@ -8,6 +8,10 @@
 #ifndef __VRV_DRAWING_INTERFACE_H__
 #define __VRV_DRAWING_INTERFACE_H__
 
+#include <unordered_set>
+
+//----------------------------------------------------------------------------
+
 #include "clef.h"
 #include "devicecontextbase.h"
 #include "keysig.h"
@@ -82,6 +86,10 @@ protected:
     /** The list of object for which drawing is postponed */
     ArrayOfObjects m_drawingList;
 
+private:
+    /** The objects in the drawing list, for avoiding duplicates without looking through it */
+    std::unordered_set<const Object *> m_drawingListObjects;
+
 private:
     //
 };
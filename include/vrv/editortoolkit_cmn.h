@@ -24,6 +24,8 @@
 namespace vrv {
 
 class EditorTreeObject;
+class EditorUndoDelta;
+class EditorUndoStep;
 
 //--------------------------------------------------------------------------------
 // EditorToolkitCMN
@@ -55,7 +57,27 @@ protected:
     bool ParseSetAction(jsonxx::Object param, std::string &elementId, std::string &attribute, std::string &value);
     ///@}
 
+    /**
+     * Undo preparation.
+     * PrepareUndo opens a new undo step when none is prepared and clears the redo stack.
+     * The edit functions then record what they change in the step, as reversible deltas whenever possible.
+     */
+    ///@{
     void PrepareUndo();
+    void AddUndoForAttributes(const Object *element);
+    void AddUndoForInsertion(const Object *element);
+    void AddUndoForDetachment(const Object *parent, Object *element, int idx);
+    void AddUndoForSnapshot();
+    void AddUndoDelta(const EditorUndoDelta &delta);
+    ///@}
+
+    /**
+     * Revert the deltas of an undo step in reverse order and fill the inverse step.
+     * Return false if one of the deltas could not be applied.
+     */
+    bool RevertUndoStep(EditorUndoStep *step, EditorUndoStep *inverseStep);
+
+    void ClearUndoStack(std::deque<EditorUndoStep *> &stack);
     std::string GetCurrentState();
     bool ReloadState(const std::string &data);
     void TrimUndoMemory();
@@ -99,9 +121,11 @@ protected:
     std::string m_chainedId;
 
     bool m_undoPrepared;
-    std::deque<std::string> m_undoStack;
-    std::deque<std::string> m_redoStack;
+    std::deque<EditorUndoStep *> m_undoStack;
+    std::deque<EditorUndoStep *> m_redoStack;
     size_t m_undoMemoryUsage = 0;
+    /** A flag indicating that the last undo or redo reloaded the whole document */
+    bool m_undoReloaded;
 
     EditorTreeObject *m_scoreContext;
     EditorTreeObject *m_sectionContext;
@@ -163,6 +187,71 @@ private:
 #endif /* NO_EDIT_SUPPORT */
 };
 
+#ifndef NO_EDIT_SUPPORT
+
+//----------------------------------------------------------------------------
+// EditorUndoDelta
+//----------------------------------------------------------------------------
+
+enum EditorUndoDeltaType { UNDO_ATTRIBUTES = 0, UNDO_INSERTION, UNDO_DETACHMENT, UNDO_SNAPSHOT };
+
+/**
+ * This class stores one reversible change made by an editor action.
+ * Elements are referred to by id because reloading a snapshot replaces all the objects of the document.
+ * - UNDO_ATTRIBUTES: m_object is a detached copy holding the attributes of the element m_id
+ * - UNDO_INSERTION: the element m_id was added to the document and is detached when reverted
+ * - UNDO_DETACHMENT: m_object was detached from its parent m_id at m_idx and is inserted back when reverted
+ * - UNDO_SNAPSHOT: m_state is the serialization of the whole document
+ * The objects are owned by the EditorUndoStep.
+ */
+class EditorUndoDelta {
+public:
+    EditorUndoDelta(EditorUndoDeltaType type) : m_type(type), m_idx(VRV_UNSET), m_object(NULL) {}
+
+    size_t GetMemoryUsage() const;
+
+    /**
+     * Create a detached object of the same class holding a copy of the attributes of the element.
+     * Return NULL if some of the attributes cannot be copied.
+     */
+    static Object *CreateAttributeHolder(const Object *element);
+
+    /**
+     * Copy all the attributes (and the text content of text elements) to an element of the same class.
+     */
+    static void CopyAllAttributes(const Object *element, Object *target);
+
+public:
+    EditorUndoDeltaType m_type;
+    std::string m_id;
+    int m_idx;
+    Object *m_object;
+    std::string m_state;
+};
+
+//----------------------------------------------------------------------------
+// EditorUndoStep
+//----------------------------------------------------------------------------
+
+/**
+ * This class stores the deltas of the actions between two commits.
+ */
+class EditorUndoStep {
+public:
+    EditorUndoStep() : m_memoryUsage(0) {}
+    ~EditorUndoStep();
+    EditorUndoStep(const EditorUndoStep &) = delete;
+    EditorUndoStep &operator=(const EditorUndoStep &) = delete;
+
+    void AddDelta(const EditorUndoDelta &delta);
+
+public:
+    std::vector<EditorUndoDelta> m_deltas;
+    size_t m_memoryUsage;
+};
+
+#endif /* NO_EDIT_SUPPORT */
+
 } // namespace vrv
 
 #endif
@@ -139,6 +139,99 @@ private:
     bool m_allLayersButCurrent;
 };
 
+//----------------------------------------------------------------------------
+// LayerElementIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class stores the layer elements of a system grouped by measure in traversal order.
+ * Each element is stored with its staff and cross staff number, which do not change during the layout.
+ * It is used for finding spanned elements without traversing the system again.
+ */
+class LayerElementIndex {
+public:
+    struct Entry {
+        const LayerElement *m_element;
+        int m_staffN;
+        // The number of the cross staff, zero if none
+        int m_crossStaffN;
+    };
+    using MeasureEntries = std::pair<const Measure *, std::vector<Entry>>;
+
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    LayerElementIndex() = default;
+    virtual ~LayerElementIndex() = default;
+    ///@}
+
+    /**
+     * Add a measure - the elements added afterwards are stored for it
+     */
+    void AddMeasure(const Measure *measure) { m_measures.push_back({ measure, {} }); }
+
+    /**
+     * Add an element to the last measure added
+     */
+    void AddElement(const LayerElement *element, int staffN, int crossStaffN);
+
+    /**
+     * Retrieve the measures with their elements
+     */
+    const std::vector<MeasureEntries> &GetMeasures() const { return m_measures; }
+
+private:
+    //
+public:
+    //
+private:
+    // The measures with their elements
+    std::vector<MeasureEntries> m_measures;
+};
+
+//----------------------------------------------------------------------------
+// CollectLayerElementIndexFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class fills a LayerElementIndex with the layer elements of a system.
+ * It skips the elements of the score definition like FindSpannedLayerElementsFunctor does.
+ */
+class CollectLayerElementIndexFunctor : public ConstFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    CollectLayerElementIndexFunctor(LayerElementIndex *index);
+    virtual ~CollectLayerElementIndexFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return false; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitLayerElement(const LayerElement *layerElement) override;
+    FunctorCode VisitMeasure(const Measure *measure) override;
+    ///@}
+
+protected:
+    //
+private:
+    //
+public:
+    //
+private:
+    // The index to fill
+    LayerElementIndex *m_index;
+};
+
 //----------------------------------------------------------------------------
 // FindSpannedLayerElementsFunctor
 //----------------------------------------------------------------------------
@@ -192,6 +285,12 @@ public:
      */
     std::vector<const LayerElement *> GetElements() const { return m_elements; }
 
+    /*
+     * Run the search on the elements of an index instead of processing the container.
+     * The container must be the system of the index or one of its measures; returns false otherwise.
+     */
+    bool ProcessIndex(const LayerElementIndex &index, const Object *container);
+
     /*
      * Functor interface
      */
@@ -203,7 +302,15 @@ public:
 protected:
     //
 private:
-    //
+    // Check if the staff number or the cross staff number is one of the staff numbers to consider
+    bool IsInStaffNs(int staffN, int crossStaffN) const;
+
+    // Check the position, layer and alignment of an element - the class and staff are checked separately
+    bool IsSpanned(const LayerElement *layerElement) const;
+
+    // Check if a measure is between the start and end measure of the interface
+    bool IsInMeasureRange(const Measure *measure) const;
+
 public:
     //
 private:
@@ -10,6 +10,7 @@
 
 #include "comparison.h"
 #include "functorinterface.h"
+#include "vrv.h"
 #include "vrvdef.h"
 
 namespace vrv {
@@ -29,7 +30,7 @@ public:
      * @name Constructors, destructors
      */
     ///@{
-    FunctorBase() {}
+    FunctorBase() { m_profiler = Profiler::GetActive(); }
     virtual ~FunctorBase() = default;
     ///@}
 
@@ -71,11 +72,52 @@ public:
     }
     ///@}
 
+    /**
+     * Getter/Setter for the classes visited by the functor.
+     * When set, the subtrees without any of these classes are not processed.
+     * It must include every class for which the functor overrides a Visit method.
+     */
+    ///@{
+    const ClassIdSet *GetClassIds() const { return (m_hasClassIds) ? &m_classIds : NULL; }
+    void SetClassIds(const std::vector<ClassId> &classIds)
+    {
+        m_classIds.reset();
+        for (ClassId classId : classIds) m_classIds.set(classId);
+        m_hasClassIds = true;
+    }
+    void SetClassIdSet(const ClassIdSet &classIds)
+    {
+        m_classIds = classIds;
+        m_hasClassIds = true;
+    }
+    ///@}
+
     /**
      * Return true if the functor implements the end interface
      */
     virtual bool ImplementsEndInterface() const = 0;
 
+    /**
+     * Profiling of the functor, with the profiler active when it was created (NULL if none).
+     * The profiling is started and stopped by the top-level Object::Process call.
+     */
+    ///@{
+    Profiler *GetProfiler() const { return m_profiler; }
+    bool IsProfiling() const { return m_profiling; }
+    void StartProfiling()
+    {
+        m_profiling = true;
+        m_visitCount = 0;
+        m_profiler->Enter(m_profiler->GetTypeName(typeid(*this)).c_str());
+    }
+    void StopProfiling()
+    {
+        m_profiler->Leave(m_visitCount);
+        m_profiling = false;
+    }
+    void CountVisit() { ++m_visitCount; }
+    ///@}
+
 private:
     //
 public:
@@ -89,6 +131,13 @@ private:
     bool m_visibleOnly = true;
     // Direction
     bool m_direction = FORWARD;
+    // The classes visited (if declared)
+    ClassIdSet m_classIds;
+    bool m_hasClassIds = false;
+    // The profiler (if any) and the number of objects visited
+    Profiler *m_profiler = NULL;
+    bool m_profiling = false;
+    long m_visitCount = 0;
 };
 
 //----------------------------------------------------------------------------
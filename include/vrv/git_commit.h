@@ -0,0 +1,7 @@
+////////////////////////////////////////////////////////
+/// Git commit version file generated at compilation ///
+/// Timestamp: 2026-10-17T23:13:09Z                  ///
+////////////////////////////////////////////////////////
+
+#define GIT_COMMIT "-23ef987-dirty"
+
@@ -9,6 +9,8 @@
 #define __VRV_GLYPH_H__
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -16,6 +18,10 @@
 #include "devicecontextbase.h"
 #include "vrvdef.h"
 
+namespace pugi {
+class xml_document;
+}
+
 namespace vrv {
 
 /**
@@ -118,6 +124,12 @@ public:
      */
     std::string GetXML() const;
 
+    /**
+     * Return the XML (content) of the glyph as parsed document.
+     * The XML is loaded and parsed only once and then kept for subsequent calls.
+     */
+    const pugi::xml_document *GetXMLDocument() const;
+
 private:
     //
 public:
@@ -138,10 +150,15 @@ private:
     std::string m_path;
     /** XML of the content for files loaded from zip archive custom font */
     std::string m_xml;
+    /** The parsed XML content, loaded when first needed */
+    mutable std::shared_ptr<const pugi::xml_document> m_xmlDocument;
     /** A map of the available anchors */
     std::map<SMuFLGlyphAnchor, Point> m_anchors;
     /** A flag indicating it is a fallback */
     bool m_isFallback;
+
+    /** The mutex for loading the parsed XML content, since glyphs are shared between threads */
+    static std::mutex s_xmlDocumentMutex;
 };
 
 } // namespace vrv
@@ -679,6 +679,11 @@ public:
      */
     bool IsSupportedChild(ClassId classId) override;
 
+    /**
+     * Do not copy children for TimestampAligner (they are generated when preparing the data)
+     */
+    bool CopyChildren() const override { return false; }
+
     /**
      * Look for an existing TimestampAttr at a certain time.
      * Creates it if not found
@@ -82,6 +82,13 @@ public:
     // read
     virtual bool Import(std::string const &data) { return true; }
 
+    /**
+     * Import data from a buffer owned by the caller that can be modified during the import.
+     * XML-based inputs parse the buffer in place instead of copying it, which means the
+     * content of the buffer is undefined afterwards. By default it is the same as Import.
+     */
+    virtual bool ImportInPlace(std::string &data) { return this->Import(data); }
+
     /**
      * Getter for layoutInformation flag that is set to true during import
      * if layout information is found (and not to be ignored).
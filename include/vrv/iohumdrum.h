@@ -500,6 +500,9 @@ public:
     std::string GetHumdrumString();
     std::string GetMeiString();
 
+    // Apply the global and universal filters of the file set in place.
+    static void ApplyFilters(hum::HumdrumFileSet &infiles);
+
 protected:
     void clear();
     bool convertHumdrum();
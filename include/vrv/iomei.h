@@ -10,6 +10,8 @@
 
 #include <sstream>
 #include <stack>
+#include <string_view>
+#include <unordered_map>
 
 //----------------------------------------------------------------------------
 
@@ -272,6 +274,12 @@ public:
      */
     void SetSerializing(bool serializing) { m_serializing = serializing; }
 
+    /**
+     * Setter for the binary flag of the page-based serialization (default is false)
+     * See MEIBinaryCodec
+     */
+    void SetBinary(bool binary) { m_binary = binary; }
+
     /**
      * Setter for remove ids flag for the MEI output (default is false)
      */
@@ -586,6 +594,8 @@ private:
     bool m_basic;
     /** A flag indicating we are serializing page-based MEI */
     bool m_serializing;
+    /** A flag indicating the page-based serialization is output in binary form */
+    bool m_binary;
 
     /** The document node */
     pugi::xml_node m_mei;
@@ -635,6 +645,7 @@ public:
     virtual ~MEIInput();
 
     bool Import(const std::string &mei) override;
+    bool ImportInPlace(std::string &mei) override;
 
     /**
      * Setter for the page-based deserialization flag (default is false).
@@ -642,6 +653,12 @@ public:
     void SetDeserializing(bool deserializing) { m_deserializing = deserializing; }
 
 private:
+    /**
+     * Read the parsed document, either page-based or score-based.
+     * Called from Import and ImportInPlace.
+     */
+    bool ImportDocument(pugi::xml_document &doc);
+
     bool ReadDoc(pugi::xml_node root);
     bool ReadIncipits(pugi::xml_node root);
 
@@ -1019,6 +1036,57 @@ private:
     static const std::vector<std::string> s_editorialElementNames;
 };
 
+//----------------------------------------------------------------------------
+// MEIBinaryCodec
+//----------------------------------------------------------------------------
+
+/**
+ * This class encodes the XML tree of the page-based serialization in a compact binary form.
+ * Element names, attribute names and values are stored once in a string table and referred to by index.
+ * Decoding builds the XML tree directly without parsing XML text.
+ * The binary form is meant for in-memory caching (e.g., undo states) and is not a stable exchange format.
+ */
+class MEIBinaryCodec {
+public:
+    /**
+     * Return true if the data starts with the binary serialization header.
+     */
+    static bool IsBinary(const std::string &data);
+
+    /**
+     * Encode the tree of the document into a binary string.
+     */
+    static std::string Encode(const pugi::xml_document &doc);
+
+    /**
+     * Decode the binary string into the document.
+     * Return false if the data is not valid.
+     */
+    static bool Decode(const std::string &data, pugi::xml_document &doc);
+
+private:
+    /**
+     * @name Methods for writing and reading the tree and variable length integers
+     */
+    ///@{
+    static void EncodeNode(pugi::xml_node node, std::unordered_map<std::string_view, uint32_t> &strings,
+        std::vector<std::string_view> &stringTable, std::string &output);
+    static bool DecodeNode(pugi::xml_node parent, const std::vector<std::string> &stringTable,
+        const std::string &data, size_t &pos);
+    static uint32_t Intern(const char *str, std::unordered_map<std::string_view, uint32_t> &strings,
+        std::vector<std::string_view> &stringTable);
+    static void WriteVarint(uint32_t value, std::string &output);
+    static bool ReadVarint(const std::string &data, size_t &pos, uint32_t &value);
+    ///@}
+
+    //----------------//
+    // Static members //
+    //----------------//
+
+    /** The header (magic number and version) starting the binary serialization */
+    static const std::string s_header;
+};
+
 } // namespace vrv
 
 #endif
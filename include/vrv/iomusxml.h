@@ -8,6 +8,7 @@
 #ifndef __VRV_IOMUSXML_H__
 #define __VRV_IOMUSXML_H__
 
+#include <functional>
 #include <map>
 #include <optional>
 #include <queue>
@@ -52,6 +53,7 @@ class Octave;
 class Pedal;
 class Section;
 class Slur;
+class StaffDef;
 class StaffGrp;
 class Tempo;
 class Tie;
@@ -296,6 +298,7 @@ private:
 #ifndef NO_MUSICXML_SUPPORT
 public:
     bool Import(const std::string &musicxml) override;
+    bool ImportInPlace(std::string &musicxml) override;
 
 private:
     /*
@@ -428,6 +431,26 @@ private:
     bool HasContentWithValue(const pugi::xml_node node, const std::string &value) const;
     ///@}
 
+    /*
+     * @name Helper methods for selecting elements by iterating over the children instead of using XPath queries.
+     * SelectGrandchild returns the first child/grandchild[@attribute='value'] in document order.
+     * SelectBeam returns the first beam[@number='number'][text()='value'] (with any number if empty).
+     * SelectAncestor returns the closest ancestor with the given name.
+     * SelectFollowing returns the first following element (axis following::) with the given name matching the
+     * predicate, stopping as soon as it is found.
+     */
+    ///@{
+    pugi::xml_node SelectChildWithoutAttribute(
+        const pugi::xml_node node, const std::string &name, const std::string &attribute) const;
+    pugi::xml_node SelectGrandchild(const pugi::xml_node node, const std::string &child, const std::string &grandchild,
+        const std::string &attribute = "", const std::string &value = "") const;
+    pugi::xml_node SelectBeam(
+        const pugi::xml_node node, const std::string &value, const std::string &number = "") const;
+    pugi::xml_node SelectAncestor(const pugi::xml_node node, const std::string &name) const;
+    pugi::xml_node SelectFollowing(const pugi::xml_node node, const std::string &name,
+        const std::function<bool(const pugi::xml_node)> &predicate) const;
+    ///@}
+
     /*
      * @name Helper methods to work with sections and expansions.
      */
@@ -441,7 +464,7 @@ private:
      */
     ///@{
     std::string GetContent(const pugi::xml_node node) const;
-    std::string GetContentOfChild(const pugi::xml_node node, const std::string &child) const;
+    std::string GetContentOfChild(const pugi::xml_node node, const pugi::xpath_query &query) const;
     ///@}
 
     /*
@@ -491,6 +514,11 @@ private:
     std::pair<std::vector<int>, int> GetMeterSigGrpValues(const pugi::xml_node &node, MeterSigGrp *parent);
     ///@}
 
+    /*
+     * Returns the measures added to the section with the given @n, in document order.
+     */
+    const std::vector<Measure *> &GetMeasuresByN(const std::string &n) const;
+
     /*
      * @name Helper method for multirests. Returns number of measure hidden by MRest before
      * measure with certain index
@@ -657,6 +685,10 @@ private:
     std::vector<std::pair<Arpeg *, musicxml::OpenArpeggio>> m_ArpeggioStack;
     /* a map for the measure counts storing the index of each measure created */
     std::map<Measure *, int> m_measureCounts;
+    /* the measures added to the section by @n, in document order */
+    std::map<std::string, std::vector<Measure *>> m_measuresByN;
+    /* a cache for the staffDef of each staff @n */
+    std::map<int, StaffDef *> m_staffDefsByN;
     /* measure rests */
     std::map<int, int> m_multiRests;
     /* A flag indicating we had a clef change */
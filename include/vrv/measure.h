@@ -320,6 +320,14 @@ public:
      */
     int EnclosesTime(int time) const;
 
+    /**
+     * Return the number of times the measure is played and the duration (in milliseconds) used by EnclosesTime
+     */
+    ///@{
+    int GetRepeatCount() const { return (int)m_realTimeOnsetMilliseconds.size(); }
+    double GetRealTimeDurationMilliseconds() const;
+    ///@}
+
     /**
      * Read-only access to onset and offset.
      * Passing repeat unset return last one.
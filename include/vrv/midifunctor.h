@@ -296,6 +296,7 @@ public:
     ///@{
     void SetCurrentTempo(double tempo) { m_currentTempo = tempo; }
     const std::list<OctaveInfo> &GetOctaves() const { return m_octaves; }
+    const ListOfConstObjects &GetTrackObjects() const { return m_trackObjects; }
     ///@}
 
     /*
@@ -304,6 +305,10 @@ public:
     ///@{
     FunctorCode VisitMeasure(const Measure *measure) override;
     FunctorCode VisitOctave(const Octave *octave) override;
+    FunctorCode VisitPedal(const Pedal *pedal) override;
+    FunctorCode VisitScoreDef(const ScoreDef *scoreDef) override;
+    FunctorCode VisitStaff(const Staff *staff) override;
+    FunctorCode VisitStaffDef(const StaffDef *staffDef) override;
     ///@}
 
 protected:
@@ -317,6 +322,8 @@ private:
     double m_currentTempo;
     // Octave info which is collected
     std::list<OctaveInfo> m_octaves;
+    // The measures, staves, pedals and scoreDef / staffDef from which the tracks are generated, in document order
+    ListOfConstObjects m_trackObjects;
 };
 
 //----------------------------------------------------------------------------
@@ -204,6 +204,63 @@ private:
     //
 };
 
+//----------------------------------------------------------------------------
+// CompositeFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class runs a group of functors in a single traversal.
+ * Each object is dispatched to each functor in order, with FUNCTOR_SIBLINGS and FUNCTOR_STOP
+ * applying to the functor returning it only. The functors must not depend on the results of each
+ * other on other objects, and must all be processed in the same direction without filters.
+ */
+class CompositeFunctor : public Functor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    CompositeFunctor(const std::vector<Functor *> &functors);
+    virtual ~CompositeFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return true; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitObject(Object *object) override;
+    FunctorCode VisitObjectEnd(Object *object) override;
+    ///@}
+
+protected:
+    //
+private:
+    /**
+     * Resume the functors that skipped the children of the object.
+     */
+    void ResumeFunctors(const Object *object);
+
+    /**
+     * Return FUNCTOR_CONTINUE if one functor is still processing, FUNCTOR_STOP otherwise.
+     */
+    FunctorCode GetCompositeCode() const;
+
+public:
+    //
+private:
+    // The functors
+    std::vector<Functor *> m_functors;
+    // For each functor, the object for which it returned FUNCTOR_SIBLINGS (NULL if none)
+    std::vector<const Object *> m_skippingFrom;
+    // For each object being processed, the flags of the functors that visited it
+    std::vector<bool> m_visited;
+};
+
 } // namespace vrv
 
 #endif // __VRV_MISCFUNCTOR_H__
@@ -282,10 +282,21 @@ public:
     virtual void CloneReset();
 
     const std::string &GetID() const { return m_id; }
-    void SetID(const std::string &id) { m_id = id; }
+    void SetID(const std::string &id);
     void SwapID(Object *other);
     void ResetID();
 
+    /**
+     * @name Methods for adding and removing the object and its descendants to the ID index of a document.
+     * Called when children are attached or detached; an object is indexed only if its parent is.
+     * See Doc::GetIndexedObject
+     */
+    ///@{
+    void AddToIDIndex(Doc *doc);
+    void RemoveFromIDIndex();
+    bool IsIDIndexed() const { return (m_idIndexDoc != NULL); }
+    ///@}
+
     /**
      * @name Methods for converting attributes to and from their original values (i.e, external / internal).
      */
@@ -346,7 +357,11 @@ public:
      * Return a reference to the children that allows modification.
      * This method should be all only in AddChild overrides methods
      */
-    ArrayOfObjects &GetChildrenForModification() { return m_children; }
+    ArrayOfObjects &GetChildrenForModification()
+    {
+        this->InvalidateSubtreeClassIds();
+        return m_children;
+    }
 
     /**
      * Copy all the attributes of an obejct to target.
@@ -472,6 +487,7 @@ public:
 
     /**
      * Look for the Object in the children and return its position (-1 if not found)
+     * The position cached in the child is used when still valid, otherwise all the children are renumbered.
      */
     int GetChildIndex(const Object *child) const;
 
@@ -494,7 +510,7 @@ public:
 
     /**
      * Detach the child at the idx position (NULL if not found)
-     * The parent pointer is set to NULL.
+     * The parent pointer is set to NULL and the child is removed from the ID index.
      */
     Object *DetachChild(int idx);
 
@@ -512,7 +528,8 @@ public:
 
     /**
      * Look for a descendant with the specified id (returns NULL if not found)
-     * This method is a wrapper for the Object::FindByID functor.
+     * This method uses the ID index of the document for unlimited searches within an indexed tree
+     * and falls back to the Object::FindByID functor otherwise.
      */
     ///@{
     Object *FindDescendantByID(const std::string &id, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
@@ -672,6 +689,13 @@ public:
      */
     void Modify(bool modified = true) const;
 
+    /**
+     * Return true if the object or one of its descendants is of one of the classes.
+     * The classes of the subtree are cached and invalidated when children are added.
+     * Reference objects are considered to contain all classes.
+     */
+    bool HasClassInSubtree(const ClassIdSet &classIds) const;
+
     /**
      * @name Setter and getter of the attribute flag
      */
@@ -794,6 +818,22 @@ private:
     bool FiltersApply(const Filters *filters, Object *object) const;
     ///@}
 
+    /**
+     * Calculate (if necessary) and return the classes of the subtree.
+     */
+    const ClassIdSet &GetSubtreeClassIds() const;
+
+    /**
+     * Invalidate the classes of the subtree of the object and of its ancestors.
+     */
+    void InvalidateSubtreeClassIds() const;
+
+    /**
+     * Look for a descendant in the ID index of the document.
+     * Return false if the index cannot give a definitive answer and a traversal is required.
+     */
+    bool FindIndexedDescendantByID(const std::string &id, const Object *&descendant) const;
+
 public:
     /**
      * Keep an array of unsupported attributes as pairs.
@@ -802,7 +842,12 @@ public:
     ArrayOfStrAttr m_unsupported;
 
 protected:
-    //
+    /**
+     * Add the child (and its descendants) to the ID index if the object is indexed.
+     * To be called by AddChild overrides modifying the children directly.
+     */
+    void IndexChild(Object *child);
+
 private:
     /**
      * A vector of child objects.
@@ -827,6 +872,19 @@ private:
     std::string m_id;
     ///@}
 
+    /**
+     * The document in which ID index the object is registered (NULL if none).
+     * Maintained when children are attached or detached, see Object::AddToIDIndex
+     */
+    Doc *m_idIndexDoc;
+
+    /**
+     * The last known position of the object in the children of its parent.
+     * This is only a hint checked and updated by Object::GetChildIndex, so it does not need to be
+     * maintained when children are added, inserted or removed.
+     */
+    int m_idxInParent;
+
     /**
      * A reference object do not own children.
      * Destructor will not delete them.
@@ -841,6 +899,15 @@ private:
      */
     mutable bool m_isModified;
 
+    /**
+     * The classes of the object and of its descendants, with a flag indicating if they are up-to-date.
+     * When invalid, the ones of the ancestors are invalid too.
+     */
+    ///@{
+    mutable ClassIdSet m_subtreeClassIds;
+    mutable bool m_subtreeClassIdsValid;
+    ///@}
+
     /**
      * Members used for caching iterator values.
      * See Object::IterGetFirst, Object::IterGetNext and Object::IterIsNotEnd
@@ -667,6 +667,7 @@ public:
     OptionInt m_pageWidth;
     OptionIntMap m_pedalStyle;
     OptionBool m_preserveAnalyticalMarkup;
+    OptionBool m_profile;
     OptionBool m_removeIds;
     OptionBool m_scaleToPageSize;
     OptionBool m_setLocale;
@@ -681,7 +682,9 @@ public:
     OptionBool m_svgHtml5;
     OptionBool m_svgFormatRaw;
     OptionBool m_svgRemoveXlink;
+    OptionBool m_svgStream;
     OptionArray m_svgAdditionalAttribute;
+    OptionInt m_threads;
     OptionDbl m_unit;
     OptionBool m_useFacsimile;
     OptionBool m_usePgFooterForAll;
@@ -714,6 +717,7 @@ public:
     OptionArray m_fontAddCustom;
     OptionIntMap m_fontFallback;
     OptionBool m_fontLoadAll;
+    OptionBool m_fontPreload;
     OptionBool m_fontTextLiberation;
     OptionDbl m_graceFactor;
     OptionBool m_graceRhythmAlign;
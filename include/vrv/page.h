@@ -126,6 +126,12 @@ public:
      */
     void ResetAligners();
 
+    /**
+     * Reset and set the horizontal alignment only for its timing.
+     * This is enough for the timemap and MIDI, and does not need the glyph metrics.
+     */
+    void ResetTemporalAligners();
+
     /**
      * Lay out the pitch positions and stems (without redoing the entire layout)
      */
@@ -617,6 +617,7 @@ private:
 /**
  * This class processes by layer and sets drawing pointers.
  * Set Dot::m_drawingNote for Dot elements in mensural mode
+ * The state is kept by staff/layer @n, so all layers are processed in a single pass.
  */
 class PreparePointersByLayerFunctor : public Functor {
 public:
@@ -638,6 +639,8 @@ public:
      */
     ///@{
     FunctorCode VisitDot(Dot *dot) override;
+    FunctorCode VisitLayer(Layer *layer) override;
+    FunctorCode VisitLayerEnd(Layer *layer) override;
     FunctorCode VisitLayerElement(LayerElement *layerElement) override;
     FunctorCode VisitMeasureEnd(Measure *measure) override;
     ///@}
@@ -645,14 +648,23 @@ public:
 protected:
     //
 private:
-    //
+    /**
+     * Helper struct to store the state of a staff/layer
+     */
+    struct LayerState {
+        // The current note, rest etc.
+        LayerElement *currentElement = NULL;
+        // The last dot
+        Dot *lastDot = NULL;
+    };
+
 public:
     //
 private:
-    // The current note, rest etc.
-    LayerElement *m_currentElement;
-    // The last dot
-    Dot *m_lastDot;
+    // The states by staff/layer @n
+    std::map<std::pair<int, int>, LayerState> m_layerStates;
+    // The state of the layer being processed (NULL outside layers)
+    LayerState *m_currentState;
 };
 
 //----------------------------------------------------------------------------
@@ -661,7 +673,7 @@ private:
 
 /**
  * This class sets wordpos and connector ends.
- * The functor is processed by staff/layer/verse using Filters.
+ * The state is kept by staff/layer/verse @n, so all verses are processed in a single pass.
  * At the end, the functor closes opened syl in VisitDocEnd.
  */
 class PrepareLyricsFunctor : public Functor {
@@ -685,6 +697,8 @@ public:
     ///@{
     FunctorCode VisitChord(Chord *chord) override;
     FunctorCode VisitDocEnd(Doc *doc) override;
+    FunctorCode VisitLayer(Layer *layer) override;
+    FunctorCode VisitLayerEnd(Layer *layer) override;
     FunctorCode VisitNote(Note *note) override;
     FunctorCode VisitSyl(Syl *syl) override;
     ///@}
@@ -692,16 +706,31 @@ public:
 protected:
     //
 private:
-    //
+    /**
+     * Helper struct to store the state of a staff/layer
+     * The notes are shared by all the verses of the layer
+     */
+    struct LayerState {
+        // The current Syl by verse @n
+        std::map<int, Syl *> currentSyls;
+        // The last Note or Chord
+        LayerElement *lastNoteOrChord = NULL;
+        // The penultimate Note or Chord
+        LayerElement *penultimateNoteOrChord = NULL;
+    };
+
+    /**
+     * Close the opened syl at the end of the document
+     */
+    void CloseSyl(Doc *doc, Syl *syl, LayerElement *lastNoteOrChord) const;
+
 public:
     //
 private:
-    // The current Syl
-    Syl *m_currentSyl;
-    // The last Note or Chord
-    LayerElement *m_lastNoteOrChord;
-    // The penultimate Note or Chord
-    LayerElement *m_penultimateNoteOrChord;
+    // The states by staff/layer @n
+    std::map<std::pair<int, int>, LayerState> m_layerStates;
+    // The state of the layer being processed (NULL outside layers)
+    LayerState *m_currentState;
 };
 
 //----------------------------------------------------------------------------
@@ -759,7 +788,7 @@ private:
 
 /**
  * This class sets mRpt drawing numbers (if required).
- * The functor is processed by staff/layer using Filters.
+ * The state is kept by staff/layer @n, so all layers are processed in a single pass.
  */
 class PrepareRptFunctor : public DocFunctor {
 public:
@@ -792,10 +821,14 @@ private:
 public:
     //
 private:
-    // The current MRpt
-    MRpt *m_currentMRpt;
-    // The data_BOOLEAN indicating if multiNumber
-    data_BOOLEAN m_multiNumber;
+    // The current MRpt by staff/layer @n
+    std::map<std::pair<int, int>, MRpt *> m_currentMRpts;
+    // The data_BOOLEAN indicating if multiNumber by staff @n
+    std::map<int, data_BOOLEAN> m_multiNumbers;
+    // The @n of the staff being processed
+    int m_currentStaffN;
+    // The current MRpt of the layer being processed (NULL outside layers)
+    MRpt **m_currentMRpt;
 };
 
 //----------------------------------------------------------------------------
@@ -804,7 +837,7 @@ private:
 
 /**
  * This class sets Turn::m_drawingEndNote for delayed turns.
- * Needs a first pass to fill the map, processed by staff/layer after that.
+ * Needs a first pass to fill the map, processed with a state by staff/layer @n after that.
  */
 class PrepareDelayedTurnsFunctor : public Functor, public CollectAndProcess {
 public:
@@ -819,22 +852,19 @@ public:
     /*
      * Abstract base implementation
      */
-    bool ImplementsEndInterface() const override { return false; }
+    bool ImplementsEndInterface() const override { return true; }
 
     /*
      * Getter for the map of delayed turns
      */
     const std::map<LayerElement *, Turn *> &GetDelayedTurns() const { return m_delayedTurns; }
 
-    /*
-     * Reset the current turn and element
-     */
-    void ResetCurrent();
-
     /*
      * Functor interface
      */
     ///@{
+    FunctorCode VisitLayer(Layer *layer) override;
+    FunctorCode VisitLayerEnd(Layer *layer) override;
     FunctorCode VisitLayerElement(LayerElement *layerElement) override;
     FunctorCode VisitTurn(Turn *turn) override;
     ///@}
@@ -842,16 +872,25 @@ public:
 protected:
     //
 private:
-    //
+    /**
+     * Helper struct to store the state of a staff/layer
+     */
+    struct LayerState {
+        // The element to which a turn is pointing to
+        LayerElement *previousElement = NULL;
+        // The current chord
+        Chord *currentChord = NULL;
+        // The turn to which we want to set a m_drawingEndElement
+        Turn *currentTurn = NULL;
+    };
+
 public:
     //
 private:
-    // The element to which a turn is pointing to
-    LayerElement *m_previousElement;
-    // The current chord
-    Chord *m_currentChord;
-    // The turn to which we want to set a m_drawingEndElement
-    Turn *m_currentTurn;
+    // The states by staff/layer @n
+    std::map<std::pair<int, int>, LayerState> m_layerStates;
+    // The state of the layer being processed (NULL outside layers)
+    LayerState *m_currentState;
     // A map of the delayed turns and the layer elements they point to
     std::map<LayerElement *, Turn *> m_delayedTurns;
 };
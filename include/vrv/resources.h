@@ -8,6 +8,9 @@
 #ifndef __VRV_RESOURCES_H__
 #define __VRV_RESOURCES_H__
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 
@@ -25,6 +28,7 @@ namespace vrv {
 /**
  * This class provides resource values.
  * It manages fonts and glyph tables.
+ * The glyph tables of the fonts loaded from a resource directory are read-only and shared by all instances.
  */
 
 class Resources {
@@ -32,14 +36,16 @@ public:
     using StyleAttributes = std::pair<data_FONTWEIGHT, data_FONTSTYLE>;
     using GlyphTable = std::unordered_map<char32_t, Glyph>;
     using GlyphNameTable = std::unordered_map<std::string, char32_t>;
-    using GlyphTextMap = std::map<StyleAttributes, GlyphTable>;
+    using GlyphTextMap = std::map<StyleAttributes, std::shared_ptr<const GlyphTable>>;
 
     /**
      * @name Constructors, destructors, and other standard methods
      */
     ///@{
     Resources();
+    Resources(const Resources &resources);
     virtual ~Resources() = default;
+    Resources &operator=(const Resources &resources);
     ///@}
 
     /**
@@ -69,8 +75,8 @@ public:
     ///@{
     /** Init the SMufL music and text fonts */
     bool InitFonts();
-    /**  Set the font to be used and loads it if necessary */
-    bool SetFont(const std::string &fontName);
+    /**  Set the font to be used and loads it if necessary, optionally with its glyphs preloaded */
+    bool SetFont(const std::string &fontName, bool preloadGlyphs = false);
     /** Add custom (external) fonts */
     bool AddCustom(const std::vector<std::string> &extraFonts);
     /** Load all music fonts available in the resource directory */
@@ -84,6 +90,8 @@ public:
     bool SetCurrentFont(const std::string &fontName, bool allowLoading = false);
     std::string GetCurrentFont() const { return m_currentFontName; }
     bool IsFontLoaded(const std::string &fontName) const { return m_loadedFonts.find(fontName) != m_loadedFonts.end(); }
+    /** Load and parse the XML of all the glyphs of a loaded font (otherwise done when first needed) */
+    void PreloadGlyphs(const std::string &fontName) const;
     ///@}
 
     /**
@@ -150,6 +158,8 @@ private:
         const std::string GetName() const { return m_name; };
         const GlyphTable &GetGlyphTable() const { return m_glyphTable; };
         GlyphTable &GetGlyphTableForModification() { return m_glyphTable; };
+        const GlyphNameTable &GetGlyphNameTable() const { return m_glyphNameTable; };
+        GlyphNameTable &GetGlyphNameTableForModification() { return m_glyphNameTable; };
         bool isFallback() const { return m_isFallback; };
 
         void SetCSSFont(const std::string &css) { m_css = css; }
@@ -159,6 +169,8 @@ private:
         std::string m_name;
         /** The loaded SMuFL font */
         GlyphTable m_glyphTable;
+        /** The glyph name / code map (built for Bravura only) */
+        GlyphNameTable m_glyphNameTable;
         /** If the font needs to fallback when a glyph is not present **/
         const bool m_isFallback;
         /** CSS font for font loaded as zip archive */
@@ -172,23 +184,41 @@ private:
     /** Init the text font (bounding boxes and ASCII only) */
     bool InitTextFont(const std::string &fontName, const StyleAttributes &style);
 
-    const GlyphTable &GetCurrentGlyphTable() const { return m_loadedFonts.at(m_currentFontName).GetGlyphTable(); };
-    const GlyphTable &GetFallbackGlyphTable() const { return m_loadedFonts.at(m_fallbackFontName).GetGlyphTable(); };
+    /**
+     * Return the font or the text font from the shared fonts and read it if not loaded yet.
+     * Return NULL if the font could not be read.
+     */
+    ///@{
+    static std::shared_ptr<const LoadedFont> GetSharedFont(const std::string &path, const std::string &fontName);
+    static std::shared_ptr<const GlyphTable> GetSharedTextFont(const std::string &path, const std::string &fontName);
+    ///@}
+
+    /**
+     * Read a font from the resource directory or from the zip file.
+     * Return NULL if the font could not be read.
+     */
+    static std::shared_ptr<LoadedFont> ReadFont(
+        const std::string &path, const std::string &fontName, ZipFileReader *zipFile);
+
+    /**
+     * Read the text font (bounding boxes and ASCII only) from the resource directory.
+     * Return NULL if the text font could not be read.
+     */
+    static std::shared_ptr<GlyphTable> ReadTextFont(const std::string &path, const std::string &fontName);
+
+    const GlyphTable &GetCurrentGlyphTable() const { return m_loadedFonts.at(m_currentFontName)->GetGlyphTable(); };
+    const GlyphTable &GetFallbackGlyphTable() const { return m_loadedFonts.at(m_fallbackFontName)->GetGlyphTable(); };
 
     bool m_useLiberation;
     std::string m_path;
     std::string m_defaultFontName;
     std::string m_fallbackFontName;
-    std::map<std::string, LoadedFont> m_loadedFonts;
+    std::map<std::string, std::shared_ptr<const LoadedFont>> m_loadedFonts;
     std::string m_currentFontName;
 
     /** A text font used for bounding box calculations */
     GlyphTextMap m_textFont;
     mutable StyleAttributes m_currentStyle;
-    /**
-     * A map of glyph name / code
-     */
-    GlyphNameTable m_glyphNameTable;
 
     /** Cache of the last glyph that was looked up in loaded fonts */
     mutable std::optional<std::pair<char32_t, const Glyph *>> m_cachedGlyph;
@@ -202,6 +232,16 @@ private:
 
     /** The default font style */
     static const StyleAttributes k_defaultStyle;
+
+    /**
+     * The fonts and the text fonts read from the resource directories, with the path and the name as key.
+     * They are shared by all instances (and threads) and released when not used by any instance anymore.
+     */
+    ///@{
+    static std::map<std::string, std::weak_ptr<const LoadedFont>> s_sharedFonts;
+    static std::map<std::string, std::weak_ptr<const GlyphTable>> s_sharedTextFonts;
+    static std::mutex s_sharedFontsMutex;
+    ///@}
 };
 
 } // namespace vrv
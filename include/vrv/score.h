@@ -37,7 +37,9 @@ public:
     ///@{
     Score();
     Score(bool createScoreDef);
+    Score(const Score &score);
     virtual ~Score();
+    Object *Clone() const override { return new Score(*this); }
     void Reset() override;
     std::string GetClassName() const override { return "score"; }
     ///@}
@@ -57,6 +59,7 @@ public:
     ScoreDef *GetScoreDef() { return m_scoreDef; }
     const ScoreDef *GetScoreDef() const { return m_scoreDef; }
     Object *GetScoreDefSubtree() { return m_scoreDefSubtree; }
+    const Object *GetScoreDefSubtree() const { return m_scoreDefSubtree; }
     ///@}
 
     /**
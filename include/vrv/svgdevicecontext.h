@@ -249,6 +249,12 @@ public:
      */
     void SetRemoveXlink(bool removeXlink) { m_removeXlink = removeXlink; }
 
+    /**
+     * Write the graphics of the page (e.g., the systems) to the output once they are ended.
+     * Only a placeholder is kept in the SVG tree, which is filled when committing. The output is identical.
+     */
+    void SetStream(bool stream) { m_stream = stream; }
+
     /**
      * Setter for an additional CSS
      */
@@ -315,6 +321,17 @@ private:
      */
     void Commit(bool xml_declaration);
 
+    /**
+     * Write an ended graphic to m_streamedGraphics and replace it by a placeholder comment in the SVG tree.
+     * The graphic cannot be resumed anymore.
+     */
+    void StreamGraphic(pugi::xml_node node);
+
+    /**
+     * Write the SVG tree to m_outdata with the placeholders replaced by the streamed graphics
+     */
+    void SaveStreamedSVG(const std::string &indent, unsigned int flags);
+
     void WriteLine(std::string);
 
     std::string GetColor(int color) const;
@@ -410,6 +427,10 @@ private:
     bool m_formatRaw;
     // remove xlink from href attributes
     bool m_removeXlink;
+    // write the graphics of the page when ended
+    bool m_stream;
+    // the graphics written when ended
+    std::vector<std::string> m_streamedGraphics;
     // indentation value (-1 for tabs)
     int m_indent;
     // postfix to be added to font glyphs
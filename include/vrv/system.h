@@ -19,6 +19,7 @@ namespace vrv {
 class SystemMilestoneEnd;
 class DeviceContext;
 class Ending;
+class LayerElementIndex;
 class Measure;
 class ScoreDef;
 class Slur;
@@ -119,6 +120,17 @@ public:
     void ResetDrawingScoreDef();
     ///@}
 
+    /**
+     * @name Build, clear and get the index of the layer elements of the system.
+     * The index is built during the vertical layout and used for finding the elements spanned by slurs.
+     * It must be cleared as soon as the layer elements can change.
+     */
+    ///@{
+    void BuildLayerElementIndex();
+    void ClearLayerElementIndex();
+    const LayerElementIndex *GetLayerElementIndex() const { return m_layerElementIndex; }
+    ///@}
+
     /**
      * Check if the notes between the start and end have mixed drawing stem directions.
      * The start and end element are expected to be on the same staff and same layer.
@@ -246,6 +258,11 @@ private:
      * This does not mean that a staff is hidden, but only that it can be optimized.
      */
     bool m_drawingIsOptimized;
+
+    /**
+     * The index of the layer elements, NULL when not built.
+     */
+    LayerElementIndex *m_layerElementIndex;
 };
 
 } // namespace vrv
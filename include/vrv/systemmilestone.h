@@ -120,6 +120,12 @@ public:
      */
     void ConvertToPageBasedMilestone(Object *object, Object *parent);
 
+    /**
+     * Turn a copy of a milestone start back into a container.
+     * The copy has no children and must not point to the end of the original.
+     */
+    void ConvertToScoreBasedContainer();
+
     //-----------------//
     // Pseudo functors //
     //-----------------//
@@ -23,6 +23,7 @@
 
 namespace vrv {
 
+class Doc;
 class Object;
 
 //----------------------------------------------------------------------------
@@ -84,6 +85,118 @@ private:
 
 }; // class Timemap
 
+//----------------------------------------------------------------------------
+// TimemapElements
+//----------------------------------------------------------------------------
+
+/**
+ * Helper struct to store the elements being played at a given time
+ */
+struct TimemapElements {
+    std::vector<std::string> notes;
+    std::vector<std::string> chords;
+    std::vector<std::string> rests;
+    std::string measure;
+
+    bool operator==(const TimemapElements &other) const = default;
+};
+
+//----------------------------------------------------------------------------
+// TimemapIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds an index of the measures, notes and rests by real time (in milliseconds).
+ * It is filled once the timemap has been calculated and answers time queries in O(log n + k).
+ * The intervals are sorted by onset and each node of the implicit binary tree over them stores the
+ * maximum offset of its subtree. Elements are stored by ID since the index can outlive edits of the doc.
+ */
+class TimemapIndex {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    TimemapIndex();
+    virtual ~TimemapIndex();
+    ///@}
+
+    /** Resets the index */
+    void Reset();
+
+    /**
+     * Fill the index from the measures, notes and rests of the doc.
+     * The timemap of the doc must have been calculated.
+     */
+    void Build(Doc *doc);
+
+    /**
+     * Check if the index has been built
+     */
+    bool IsBuilt() const { return m_isBuilt; }
+
+    /**
+     * Fill the elements being played at the given time.
+     * Return false if no measure encloses the time.
+     */
+    bool GetElementsAtTime(int time, TimemapElements &elements) const;
+
+    /**
+     * Return the times within [start, end] at which the elements being played change.
+     * The start time is always included.
+     */
+    std::vector<int> GetChangeTimes(int start, int end) const;
+
+private:
+    /**
+     * An interval of time (inclusive, in milliseconds) of a measure or note (or rest) for a repeat
+     */
+    struct Interval {
+        int onset;
+        int offset;
+        int item;
+        int repeat;
+    };
+
+    /**
+     * A static interval tree: the intervals sorted by onset with the maximum offset of each subtree
+     */
+    struct IntervalTree {
+        std::vector<Interval> intervals;
+        std::vector<int> maxOffsets;
+
+        void Build();
+        void FindOverlapping(int start, int end, std::vector<const Interval *> &overlapping) const;
+        int FillMaxOffsets(int low, int high);
+        void FindOverlapping(int low, int high, int start, int end, std::vector<const Interval *> &overlapping) const;
+    };
+
+    struct MeasureItem {
+        std::string id;
+        std::vector<std::string> mRests;
+    };
+
+    struct NoteItem {
+        std::string id;
+        std::string chord;
+        bool isRest;
+        int measure;
+    };
+
+public:
+    //
+private:
+    /** The measures and the notes and rests in document order */
+    std::vector<MeasureItem> m_measures;
+    std::vector<NoteItem> m_notes;
+    /** The intervals of the measures and of the notes and rests */
+    IntervalTree m_measureTree;
+    IntervalTree m_noteTree;
+    /** A flag indicating the index has been built */
+    bool m_isBuilt;
+
+}; // class TimemapIndex
+
 } // namespace vrv
 
 #endif // __VRV_TIMEMAP_H__
@@ -9,6 +9,7 @@
 #define __VRV_TOOLKIT_H__
 
 #include <string>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
@@ -23,6 +24,7 @@ namespace vrv {
 
 class EditorToolkit;
 class RuntimeClock;
+class ZipFileReader;
 
 /**
  * @defgroup nodoc Public methods that are not listed in the documentation
@@ -96,6 +98,25 @@ public:
      */
     std::string GetLog();
 
+    /**
+     * Get the log content for the latest operation as a JSON array.
+     *
+     * Each entry has a level, the message, and the number of times the message was logged.
+     *
+     * @return The log entries as a stringified JSON array
+     */
+    std::string GetLogEntries();
+
+    /**
+     * Get the profile collected since the last call when the profile option is enabled.
+     *
+     * Each entry has the path of the phase or functor (e.g., "LoadData/PrepareData/PrepareLinkingFunctor"),
+     * the number of calls, the total time in milliseconds, and the number of objects visited by functors.
+     *
+     * @return The profile entries as a stringified JSON array
+     */
+    std::string GetProfile();
+
     /**
      * Return the version number.
      *
@@ -357,6 +378,21 @@ public:
      */
     std::string RenderToSVG(int pageNo = 1, bool xmlDeclaration = false);
 
+    /**
+     * Render a horizontal range of a page to SVG.
+     *
+     * This is meant for very wide pages (e.g., with breaks set to none) where only the part in
+     * view needs to be rendered. Only the measures intersecting the range are drawn.
+     * The range is given in the units of the viewBox of the full page SVG, including the left margin.
+     *
+     * @param pageNo The page to render (1-based)
+     * @param x1 The left edge of the range
+     * @param x2 The right edge of the range
+     * @param xmlDeclaration True for including the xml declaration in the SVG output
+     * @return The SVG of the range as a string
+     */
+    std::string RenderToSVGRange(int pageNo, int x1, int x2, bool xmlDeclaration = false);
+
     /**
      * Render a page to SVG and save it to the file.
      *
@@ -505,6 +541,8 @@ public:
      * scoreBased: true or false; true by default;
      * basic: true or false; false by default;
      * removeIds: true or false; false by default - remove all \@xml:id not used in the data;
+     * serialized: true or false; false by default - page-based serialization that can be reloaded as is;
+     * binary: true or false; false by default - binary form of the serialization (C++ only);
      */
     std::string GetMEI(const std::string &jsonOptions = "");
 
@@ -546,6 +584,18 @@ public:
      */
     std::string GetElementsAtTime(int millisec);
 
+    /**
+     * Return the changes of the elements being played within a time range.
+     *
+     * Each change gives the time and the elements being played from that time on, as returned by
+     * GetElementsAtTime. The first change is always at the start of the range.
+     *
+     * @param millisecStart The start time in milliseconds
+     * @param millisecEnd The end time in milliseconds
+     * @return A stringified JSON array with the times and the page and notes being played
+     */
+    std::string GetElementsAtTimeRange(int millisecStart, int millisecEnd);
+
     /**
      * Return the page on which the element is the ID (\@xml:id) is rendered
      *
@@ -661,6 +711,18 @@ public:
      */
     bool RenderToDeviceContext(int pageNo, DeviceContext *deviceContext);
 
+    /**
+     * Render a range of pages to SVG with several threads.
+     *
+     * Each thread lays out its own copy of the document and renders a share of the pages.
+     * Pages are rendered sequentially when the layout cannot be reproduced in a copy
+     * (e.g., encoded layout, facsimile, mensural music or selection).
+     * Page numbers are 1-based.
+     *
+     * @ingroup nodoc
+     */
+    std::vector<std::string> RenderToSVGPages(int from, int to, int threads, bool xmlDeclaration = false);
+
     /**
      * Return the Options object of the Toolkit instance.
      *
@@ -762,7 +824,7 @@ protected:
     void PrintOptionUsageOutput(const vrv::Option *option, std::ostream &output) const;
 
     /**
-     * Resets the vrv::logBuffer.
+     * Resets the vrv::logBuffer of the calling thread.
      */
     void ResetLogBuffer();
 
@@ -782,6 +844,12 @@ protected:
      */
     bool LoadData(const std::string &data, bool resetLogBuffer);
 
+    /**
+     * Load a string data owned by the toolkit (e.g., read from a file).
+     * XML data is parsed in place, so the content of the string is undefined afterwards.
+     */
+    bool LoadData(std::string &&data, bool resetLogBuffer);
+
     /**
      * Reset the Doc pointer used for MIDI / Timemap rendering
      */
@@ -794,6 +862,13 @@ private:
     bool IsZip(const std::string &filename);
     bool LoadZipFile(const std::string &filename);
     bool LoadZipData(const std::vector<unsigned char> &bytes);
+    bool LoadZipArchive(ZipFileReader &zipFileReader);
+
+    /**
+     * Load the data, importing it in place from the buffer when one is given.
+     * The buffer is the same string as the data and is consumed by the import.
+     */
+    bool LoadData(const std::string &data, bool resetLogBuffer, std::string *buffer);
     void GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds);
 
     /**
@@ -815,6 +890,28 @@ private:
      */
     void SetMidiDoc();
 
+    /**
+     * Render a page to SVG without resetting the log buffer
+     */
+    std::string RenderPageToSVG(int pageNo, bool xmlDeclaration);
+
+    /**
+     * Fill the JSON object with the elements being played (see GetElementsAtTime)
+     */
+    void ElementsToJson(const TimemapElements &elements, jsonxx::Object &o);
+
+    /**
+     * @name Methods for rendering pages with several threads (see RenderToSVGPages)
+     * CopyForRendering copies the options, the resources and the content of the doc to the target toolkit.
+     * LayOutCopy lays out the copied content as the doc was, and restores the page and system IDs.
+     * It returns false if the resulting pages do not match those of the doc.
+     */
+    ///@{
+    bool CanRenderConcurrently();
+    void CopyForRendering(Toolkit &target);
+    bool LayOutCopy(const ListOfConstObjects &layoutObjects, int castOffBreaks);
+    ///@}
+
 public:
     //
 private:
@@ -823,6 +920,11 @@ private:
     View m_view;
     Doc *m_midiDoc;
 
+    /**
+     * The breaks used for the cast-off of the doc, or BREAKS_none if not cast-off
+     */
+    int m_castOffBreaks;
+
     Options *m_options;
 
     std::optional<std::locale> m_previousLocale;
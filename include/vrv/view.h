@@ -161,6 +161,18 @@ public:
      */
     double GetPPUFactor() const;
 
+    /**
+     * @name Restrict the drawing to a horizontal range of the page.
+     * The range is given in logical units of the page (including the left margin).
+     * Only the measures intersecting it are drawn and the origin is shifted to its left edge.
+     */
+    ///@{
+    void SetDrawingRange(int x1, int x2);
+    void ResetDrawingRange();
+    bool HasDrawingRange() const { return (m_drawingRangeX1 != VRV_UNSET); }
+    int GetDrawingRangeWidth() const { return m_drawingRangeX2 - m_drawingRangeX1; }
+    ///@}
+
     /**
      * @name Methods for calculating drawing positions
      * Defined in view_element.cpp
@@ -207,6 +219,7 @@ protected:
     void DrawBarLineDots(DeviceContext *dc, Staff *staff, BarLine *barLine);
     void DrawLedgerLines(DeviceContext *dc, Staff *staff, const ArrayOfLedgerLines &lines, bool below, bool cueSize);
     void DrawMeasure(DeviceContext *dc, Measure *measure, System *system);
+    bool IsInDrawingRange(const Measure *measure) const;
     void DrawMeterSigGrp(DeviceContext *dc, Layer *layer, Staff *staff);
     void DrawMNum(DeviceContext *dc, MNum *mnum, Measure *measure, System *system, int yOffset);
     void DrawOssia(DeviceContext *dc, Ossia *ossia, Measure *measure, System *system);
@@ -718,6 +731,14 @@ protected:
      */
     ScoreDef m_drawingScoreDef;
 
+    /**
+     * The horizontal range to be drawn (VRV_UNSET for the full page)
+     */
+    ///@{
+    int m_drawingRangeX1;
+    int m_drawingRangeX2;
+    ///@}
+
 private:
     //----------------//
     // Static members //
@@ -8,11 +8,15 @@
 #ifndef __VRV_H__
 #define __VRV_H__
 
+#include <atomic>
+#include <chrono>
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
 #include <map>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 
@@ -40,10 +44,48 @@ void LogError(const char *fmt, ...);
 void LogInfo(const char *fmt, ...);
 void LogWarning(const char *fmt, ...);
 
+//----------------------------------------------------------------------------
+// LogBuffer
+//----------------------------------------------------------------------------
+
 /**
- * Member and functions specific to logging that uses a vector of string to buffer the logs.
+ * This class stores the log messages when logging to a buffer.
+ * Identical messages are stored only once, in order of first occurrence, and counted.
  */
-extern std::vector<std::string> logBuffer;
+class LogBuffer {
+public:
+    struct Entry {
+        LogLevel m_level;
+        std::string m_message;
+        int m_count;
+    };
+
+    /**
+     * Add a message or increase its count if it is already in the buffer
+     */
+    void Add(std::string &&message, LogLevel level);
+
+    /**
+     * Move the content of another buffer to this one
+     */
+    void Append(LogBuffer &&other);
+
+    bool Contains(const std::string &message) const { return (m_indices.count(message) > 0); }
+    void Clear();
+    bool IsEmpty() const { return m_entries.empty(); }
+    const std::vector<Entry> &GetEntries() const { return m_entries; }
+
+private:
+    std::vector<Entry> m_entries;
+    /** The position of each message in m_entries for constant time look-up */
+    std::unordered_map<std::string, int> m_indices;
+};
+
+/**
+ * Member and functions specific to logging to a buffer.
+ * The buffer is per thread, so toolkits used from different threads do not share it.
+ */
+extern thread_local LogBuffer logBuffer;
 bool LogBufferContains(const std::string &s);
 void LogString(std::string message, LogLevel level);
 
@@ -152,8 +194,8 @@ inline data_DURATION DurationMax(data_DURATION dur1, data_DURATION dur2)
 /**
  *
  */
-extern LogLevel logLevel;
-extern bool loggingToBuffer;
+extern std::atomic<LogLevel> logLevel;
+extern std::atomic<bool> loggingToBuffer;
 
 /**
  * Functions for logging in milliseconds the elapsed time of an
@@ -170,6 +212,97 @@ extern struct timeval start;
 void LogElapsedTimeStart();
 void LogElapsedTimeStop(const char *msg = "unspecified operation");
 
+//----------------------------------------------------------------------------
+// Profiler
+//----------------------------------------------------------------------------
+
+/**
+ * This class collects the time spent in the processing phases (import, PrepareData, layout, rendering, etc.)
+ * and in the functors run within them, with the number of objects they visited.
+ * Entries are aggregated by their path (e.g., "LayOut/LayOutVertically/AdjustSlursFunctor").
+ * The profiler of a phase is made active for the calling thread with a ProfileScope.
+ */
+class Profiler {
+public:
+    struct Entry {
+        std::string m_path;
+        int m_calls = 0;
+        double m_milliseconds = 0.0;
+        long m_visits = 0;
+    };
+
+    /**
+     * Enter and leave a phase or a functor, which is nested in the current one.
+     * The name is expected to remain valid (e.g., a string literal).
+     */
+    ///@{
+    void Enter(const char *name);
+    void Leave(long visits = 0);
+    ///@}
+
+    /**
+     * Add the entries of another profiler, with an optional prefix for their path
+     */
+    void Append(const Profiler &other, const std::string &prefix = "");
+
+    void Reset();
+    bool IsEmpty() const { return m_entries.empty(); }
+    const std::vector<Entry> &GetEntries() const { return m_entries; }
+
+    /**
+     * The profiler active on the calling thread (NULL if none)
+     */
+    static Profiler *GetActive() { return s_active; }
+
+    /**
+     * Return a readable name for a type, without the namespace
+     */
+    const std::string &GetTypeName(const std::type_info &type);
+
+private:
+    //
+public:
+    //
+private:
+    struct Frame {
+        int m_index;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    std::vector<Entry> m_entries;
+    /** The position of each path in m_entries */
+    std::unordered_map<std::string, int> m_indices;
+    /** The position of the children of each entry by name, for avoiding building the paths */
+    std::vector<std::unordered_map<const char *, int>> m_children;
+    std::unordered_map<const char *, int> m_topChildren;
+    /** The phases currently entered */
+    std::vector<Frame> m_frames;
+    /** The readable names of the types already seen */
+    std::unordered_map<std::type_index, std::string> m_typeNames;
+
+    static thread_local Profiler *s_active;
+
+    friend class ProfileScope;
+};
+
+//----------------------------------------------------------------------------
+// ProfileScope
+//----------------------------------------------------------------------------
+
+/**
+ * Enter a phase of the profiler for the lifetime of the object and make the profiler active.
+ * Nothing is done when the profiler is NULL, i.e., when profiling is disabled.
+ */
+class ProfileScope {
+public:
+    ProfileScope(Profiler *profiler, const char *name);
+    ~ProfileScope();
+
+private:
+    Profiler *m_profiler;
+    Profiler *m_previous;
+};
+
 //----------------------------------------------------------------------------
 // Notation type checks
 //----------------------------------------------------------------------------
@@ -9,11 +9,13 @@
 #define __VRV_DEF_H__
 
 #include <algorithm>
+#include <bitset>
 #include <functional>
 #include <list>
 #include <map>
 #include <set>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -356,6 +358,8 @@ typedef std::set<const Object *> SetOfConstObjects;
 
 typedef std::set<const Object *> SetOfConstObjects;
 
+typedef std::bitset<UNSPECIFIED + 1> ClassIdSet;
+
 typedef std::vector<Note *> ChordNoteGroup;
 
 typedef std::vector<std::tuple<Alignment *, Alignment *, int>> ArrayOfAdjustmentTuples;
@@ -410,6 +414,8 @@ typedef std::map<ClassId, std::function<Object *(void)>> MapOfClassIdConstructor
 
 typedef std::map<std::string, ClassId> MapOfStrClassIds;
 
+typedef std::unordered_multimap<std::string, Object *> MultiMapOfStrObjects;
+
 typedef std::vector<std::pair<LayerElement *, LayerElement *>> MeasureTieEndpoints;
 
 typedef bool (*NotePredicate)(const Note *);
@@ -39,9 +39,10 @@ void AttHarmAnl::ResetHarmAnl()
 bool AttHarmAnl::ReadHarmAnl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHarmAnlForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToHarmAnlForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -79,9 +80,10 @@ void AttHarmonicFunction::ResetHarmonicFunction()
 bool AttHarmonicFunction::ReadHarmonicFunction(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("deg")) {
-        this->SetDeg(StrToStr(element.attribute("deg").value()));
-        if (removeAttr) element.remove_attribute("deg");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("deg")) {
+        this->SetDeg(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -119,9 +121,10 @@ void AttIntervalHarmonic::ResetIntervalHarmonic()
 bool AttIntervalHarmonic::ReadIntervalHarmonic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("inth")) {
-        this->SetInth(StrToStr(element.attribute("inth").value()));
-        if (removeAttr) element.remove_attribute("inth");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("inth")) {
+        this->SetInth(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -159,9 +162,10 @@ void AttIntervalMelodic::ResetIntervalMelodic()
 bool AttIntervalMelodic::ReadIntervalMelodic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("intm")) {
-        this->SetIntm(StrToStr(element.attribute("intm").value()));
-        if (removeAttr) element.remove_attribute("intm");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("intm")) {
+        this->SetIntm(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -201,19 +205,20 @@ void AttKeySigDefaultAnl::ResetKeySigDefaultAnl()
 bool AttKeySigDefaultAnl::ReadKeySigDefaultAnl(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("key.accid")) {
-        this->SetKeyAccid(StrToAccidentalGestural(element.attribute("key.accid").value()));
-        if (removeAttr) element.remove_attribute("key.accid");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("key.accid")) {
+        this->SetKeyAccid(StrToAccidentalGestural(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("key.mode")) {
-        this->SetKeyMode(StrToMode(element.attribute("key.mode").value()));
-        if (removeAttr) element.remove_attribute("key.mode");
+    if (pugi::xml_attribute attr = element.attribute("key.mode")) {
+        this->SetKeyMode(StrToMode(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("key.pname")) {
-        this->SetKeyPname(StrToPitchname(element.attribute("key.pname").value()));
-        if (removeAttr) element.remove_attribute("key.pname");
+    if (pugi::xml_attribute attr = element.attribute("key.pname")) {
+        this->SetKeyPname(StrToPitchname(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -269,9 +274,10 @@ void AttMelodicFunction::ResetMelodicFunction()
 bool AttMelodicFunction::ReadMelodicFunction(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("mfunc")) {
-        this->SetMfunc(StrToMelodicfunction(element.attribute("mfunc").value()));
-        if (removeAttr) element.remove_attribute("mfunc");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("mfunc")) {
+        this->SetMfunc(StrToMelodicfunction(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -309,9 +315,10 @@ void AttPitchClass::ResetPitchClass()
 bool AttPitchClass::ReadPitchClass(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pclass")) {
-        this->SetPclass(StrToInt(element.attribute("pclass").value()));
-        if (removeAttr) element.remove_attribute("pclass");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("pclass")) {
+        this->SetPclass(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -349,9 +356,10 @@ void AttSolfa::ResetSolfa()
 bool AttSolfa::ReadSolfa(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("psolfa")) {
-        this->SetPsolfa(StrToStr(element.attribute("psolfa").value()));
-        if (removeAttr) element.remove_attribute("psolfa");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("psolfa")) {
+        this->SetPsolfa(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
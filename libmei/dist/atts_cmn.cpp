@@ -39,9 +39,10 @@ void AttArpegLog::ResetArpegLog()
 bool AttArpegLog::ReadArpegLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("order")) {
-        this->SetOrder(StrToArpegLogOrder(element.attribute("order").value()));
-        if (removeAttr) element.remove_attribute("order");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("order")) {
+        this->SetOrder(StrToArpegLogOrder(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -79,9 +80,10 @@ void AttBeamPresent::ResetBeamPresent()
 bool AttBeamPresent::ReadBeamPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam")) {
-        this->SetBeam(StrToStr(element.attribute("beam").value()));
-        if (removeAttr) element.remove_attribute("beam");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("beam")) {
+        this->SetBeam(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -122,24 +124,25 @@ void AttBeamRend::ResetBeamRend()
 bool AttBeamRend::ReadBeamRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToBeamRendForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToBeamRendForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("place")) {
-        this->SetPlace(StrToBeamplace(element.attribute("place").value()));
-        if (removeAttr) element.remove_attribute("place");
+    if (pugi::xml_attribute attr = element.attribute("place")) {
+        this->SetPlace(StrToBeamplace(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("slash")) {
-        this->SetSlash(StrToBoolean(element.attribute("slash").value()));
-        if (removeAttr) element.remove_attribute("slash");
+    if (pugi::xml_attribute attr = element.attribute("slash")) {
+        this->SetSlash(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("slope")) {
-        this->SetSlope(StrToDbl(element.attribute("slope").value()));
-        if (removeAttr) element.remove_attribute("slope");
+    if (pugi::xml_attribute attr = element.attribute("slope")) {
+        this->SetSlope(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -204,9 +207,10 @@ void AttBeamSecondary::ResetBeamSecondary()
 bool AttBeamSecondary::ReadBeamSecondary(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("breaksec")) {
-        this->SetBreaksec(StrToInt(element.attribute("breaksec").value()));
-        if (removeAttr) element.remove_attribute("breaksec");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("breaksec")) {
+        this->SetBreaksec(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -244,9 +248,10 @@ void AttBeamedWith::ResetBeamedWith()
 bool AttBeamedWith::ReadBeamedWith(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.with")) {
-        this->SetBeamWith(StrToNeighboringlayer(element.attribute("beam.with").value()));
-        if (removeAttr) element.remove_attribute("beam.with");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("beam.with")) {
+        this->SetBeamWith(StrToNeighboringlayer(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -285,14 +290,15 @@ void AttBeamingLog::ResetBeamingLog()
 bool AttBeamingLog::ReadBeamingLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beam.group")) {
-        this->SetBeamGroup(StrToStr(element.attribute("beam.group").value()));
-        if (removeAttr) element.remove_attribute("beam.group");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("beam.group")) {
+        this->SetBeamGroup(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("beam.rests")) {
-        this->SetBeamRests(StrToBoolean(element.attribute("beam.rests").value()));
-        if (removeAttr) element.remove_attribute("beam.rests");
+    if (pugi::xml_attribute attr = element.attribute("beam.rests")) {
+        this->SetBeamRests(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -339,9 +345,10 @@ void AttBeatRptLog::ResetBeatRptLog()
 bool AttBeatRptLog::ReadBeatRptLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("beatdef")) {
-        this->SetBeatdef(StrToDbl(element.attribute("beatdef").value()));
-        if (removeAttr) element.remove_attribute("beatdef");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("beatdef")) {
+        this->SetBeatdef(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -379,9 +386,10 @@ void AttBracketSpanLog::ResetBracketSpanLog()
 bool AttBracketSpanLog::ReadBracketSpanLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToBracketSpanLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("func")) {
+        this->SetFunc(StrToBracketSpanLogFunc(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -419,9 +427,10 @@ void AttCutout::ResetCutout()
 bool AttCutout::ReadCutout(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cutout")) {
-        this->SetCutout(StrToCutoutCutout(element.attribute("cutout").value()));
-        if (removeAttr) element.remove_attribute("cutout");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("cutout")) {
+        this->SetCutout(StrToCutoutCutout(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -459,9 +468,10 @@ void AttExpandable::ResetExpandable()
 bool AttExpandable::ReadExpandable(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("expand")) {
-        this->SetExpand(StrToBoolean(element.attribute("expand").value()));
-        if (removeAttr) element.remove_attribute("expand");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("expand")) {
+        this->SetExpand(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -499,9 +509,10 @@ void AttGlissPresent::ResetGlissPresent()
 bool AttGlissPresent::ReadGlissPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("gliss")) {
-        this->SetGliss(StrToGlissando(element.attribute("gliss").value()));
-        if (removeAttr) element.remove_attribute("gliss");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("gliss")) {
+        this->SetGliss(StrToGlissando(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -539,9 +550,10 @@ void AttGraceGrpLog::ResetGraceGrpLog()
 bool AttGraceGrpLog::ReadGraceGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("attach")) {
-        this->SetAttach(StrToGraceGrpLogAttach(element.attribute("attach").value()));
-        if (removeAttr) element.remove_attribute("attach");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("attach")) {
+        this->SetAttach(StrToGraceGrpLogAttach(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -580,14 +592,15 @@ void AttGraced::ResetGraced()
 bool AttGraced::ReadGraced(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("grace")) {
-        this->SetGrace(StrToGrace(element.attribute("grace").value()));
-        if (removeAttr) element.remove_attribute("grace");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("grace")) {
+        this->SetGrace(StrToGrace(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("grace.time")) {
-        this->SetGraceTime(StrToPercent(element.attribute("grace.time").value()));
-        if (removeAttr) element.remove_attribute("grace.time");
+    if (pugi::xml_attribute attr = element.attribute("grace.time")) {
+        this->SetGraceTime(StrToPercent(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -635,14 +648,15 @@ void AttHairpinLog::ResetHairpinLog()
 bool AttHairpinLog::ReadHairpinLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToHairpinLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToHairpinLogForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("niente")) {
-        this->SetNiente(StrToBoolean(element.attribute("niente").value()));
-        if (removeAttr) element.remove_attribute("niente");
+    if (pugi::xml_attribute attr = element.attribute("niente")) {
+        this->SetNiente(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -695,39 +709,40 @@ void AttHarpPedalLog::ResetHarpPedalLog()
 bool AttHarpPedalLog::ReadHarpPedalLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("c")) {
-        this->SetC(StrToHarppedalposition(element.attribute("c").value()));
-        if (removeAttr) element.remove_attribute("c");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("c")) {
+        this->SetC(StrToHarppedalposition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("d")) {
-        this->SetD(StrToHarppedalposition(element.attribute("d").value()));
-        if (removeAttr) element.remove_attribute("d");
+    if (pugi::xml_attribute attr = element.attribute("d")) {
+        this->SetD(StrToHarppedalposition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("e")) {
-        this->SetE(StrToHarppedalposition(element.attribute("e").value()));
-        if (removeAttr) element.remove_attribute("e");
+    if (pugi::xml_attribute attr = element.attribute("e")) {
+        this->SetE(StrToHarppedalposition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("f")) {
-        this->SetF(StrToHarppedalposition(element.attribute("f").value()));
-        if (removeAttr) element.remove_attribute("f");
+    if (pugi::xml_attribute attr = element.attribute("f")) {
+        this->SetF(StrToHarppedalposition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("g")) {
-        this->SetG(StrToHarppedalposition(element.attribute("g").value()));
-        if (removeAttr) element.remove_attribute("g");
+    if (pugi::xml_attribute attr = element.attribute("g")) {
+        this->SetG(StrToHarppedalposition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("a")) {
-        this->SetA(StrToHarppedalposition(element.attribute("a").value()));
-        if (removeAttr) element.remove_attribute("a");
+    if (pugi::xml_attribute attr = element.attribute("a")) {
+        this->SetA(StrToHarppedalposition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("b")) {
-        this->SetB(StrToHarppedalposition(element.attribute("b").value()));
-        if (removeAttr) element.remove_attribute("b");
+    if (pugi::xml_attribute attr = element.attribute("b")) {
+        this->SetB(StrToHarppedalposition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -819,9 +834,10 @@ void AttLvPresent::ResetLvPresent()
 bool AttLvPresent::ReadLvPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("lv")) {
-        this->SetLv(StrToBoolean(element.attribute("lv").value()));
-        if (removeAttr) element.remove_attribute("lv");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("lv")) {
+        this->SetLv(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -860,14 +876,15 @@ void AttMeasureLog::ResetMeasureLog()
 bool AttMeasureLog::ReadMeasureLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("left")) {
-        this->SetLeft(StrToBarrendition(element.attribute("left").value()));
-        if (removeAttr) element.remove_attribute("left");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("left")) {
+        this->SetLeft(StrToBarrendition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("right")) {
-        this->SetRight(StrToBarrendition(element.attribute("right").value()));
-        if (removeAttr) element.remove_attribute("right");
+    if (pugi::xml_attribute attr = element.attribute("right")) {
+        this->SetRight(StrToBarrendition(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -914,9 +931,10 @@ void AttMeterSigGrpLog::ResetMeterSigGrpLog()
 bool AttMeterSigGrpLog::ReadMeterSigGrpLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("func")) {
-        this->SetFunc(StrToMeterSigGrpLogFunc(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("func")) {
+        this->SetFunc(StrToMeterSigGrpLogFunc(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -955,14 +973,15 @@ void AttNumberPlacement::ResetNumberPlacement()
 bool AttNumberPlacement::ReadNumberPlacement(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num.place")) {
-        this->SetNumPlace(StrToStaffrelBasic(element.attribute("num.place").value()));
-        if (removeAttr) element.remove_attribute("num.place");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("num.place")) {
+        this->SetNumPlace(StrToStaffrelBasic(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("num.visible")) {
-        this->SetNumVisible(StrToBoolean(element.attribute("num.visible").value()));
-        if (removeAttr) element.remove_attribute("num.visible");
+    if (pugi::xml_attribute attr = element.attribute("num.visible")) {
+        this->SetNumVisible(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1009,9 +1028,10 @@ void AttNumbered::ResetNumbered()
 bool AttNumbered::ReadNumbered(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToInt(element.attribute("num").value()));
-        if (removeAttr) element.remove_attribute("num");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("num")) {
+        this->SetNum(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1049,9 +1069,10 @@ void AttOctaveLog::ResetOctaveLog()
 bool AttOctaveLog::ReadOctaveLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("coll")) {
-        this->SetColl(StrToOctaveLogColl(element.attribute("coll").value()));
-        if (removeAttr) element.remove_attribute("coll");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("coll")) {
+        this->SetColl(StrToOctaveLogColl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1090,14 +1111,15 @@ void AttPedalLog::ResetPedalLog()
 bool AttPedalLog::ReadPedalLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("dir")) {
-        this->SetDir(StrToPedalLogDir(element.attribute("dir").value()));
-        if (removeAttr) element.remove_attribute("dir");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("dir")) {
+        this->SetDir(StrToPedalLogDir(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("func")) {
-        this->SetFunc(StrToStr(element.attribute("func").value()));
-        if (removeAttr) element.remove_attribute("func");
+    if (pugi::xml_attribute attr = element.attribute("func")) {
+        this->SetFunc(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1144,9 +1166,10 @@ void AttPianoPedals::ResetPianoPedals()
 bool AttPianoPedals::ReadPianoPedals(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("pedal.style")) {
-        this->SetPedalStyle(StrToPedalstyle(element.attribute("pedal.style").value()));
-        if (removeAttr) element.remove_attribute("pedal.style");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("pedal.style")) {
+        this->SetPedalStyle(StrToPedalstyle(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1184,9 +1207,10 @@ void AttRehearsal::ResetRehearsal()
 bool AttRehearsal::ReadRehearsal(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("reh.enclose")) {
-        this->SetRehEnclose(StrToRehearsalRehenclose(element.attribute("reh.enclose").value()));
-        if (removeAttr) element.remove_attribute("reh.enclose");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("reh.enclose")) {
+        this->SetRehEnclose(StrToRehearsalRehenclose(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1225,14 +1249,15 @@ void AttSlurRend::ResetSlurRend()
 bool AttSlurRend::ReadSlurRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("slur.lform")) {
-        this->SetSlurLform(StrToLineform(element.attribute("slur.lform").value()));
-        if (removeAttr) element.remove_attribute("slur.lform");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("slur.lform")) {
+        this->SetSlurLform(StrToLineform(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("slur.lwidth")) {
-        this->SetSlurLwidth(StrToLinewidth(element.attribute("slur.lwidth").value()));
-        if (removeAttr) element.remove_attribute("slur.lwidth");
+    if (pugi::xml_attribute attr = element.attribute("slur.lwidth")) {
+        this->SetSlurLwidth(StrToLinewidth(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1279,9 +1304,10 @@ void AttStemsCmn::ResetStemsCmn()
 bool AttStemsCmn::ReadStemsCmn(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("stem.with")) {
-        this->SetStemWith(StrToNeighboringlayer(element.attribute("stem.with").value()));
-        if (removeAttr) element.remove_attribute("stem.with");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("stem.with")) {
+        this->SetStemWith(StrToNeighboringlayer(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1320,14 +1346,15 @@ void AttTieRend::ResetTieRend()
 bool AttTieRend::ReadTieRend(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tie.lform")) {
-        this->SetTieLform(StrToLineform(element.attribute("tie.lform").value()));
-        if (removeAttr) element.remove_attribute("tie.lform");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("tie.lform")) {
+        this->SetTieLform(StrToLineform(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tie.lwidth")) {
-        this->SetTieLwidth(StrToLinewidth(element.attribute("tie.lwidth").value()));
-        if (removeAttr) element.remove_attribute("tie.lwidth");
+    if (pugi::xml_attribute attr = element.attribute("tie.lwidth")) {
+        this->SetTieLwidth(StrToLinewidth(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1374,9 +1401,10 @@ void AttTremForm::ResetTremForm()
 bool AttTremForm::ReadTremForm(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToTremFormForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToTremFormForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -1414,9 +1442,10 @@ void AttTremMeasured::ResetTremMeasured()
 bool AttTremMeasured::ReadTremMeasured(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("unitdur")) {
-        this->SetUnitdur(StrToDuration(element.attribute("unitdur").value()));
-        if (removeAttr) element.remove_attribute("unitdur");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("unitdur")) {
+        this->SetUnitdur(StrToDuration(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
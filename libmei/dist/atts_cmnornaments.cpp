@@ -40,14 +40,15 @@ void AttMordentLog::ResetMordentLog()
 bool AttMordentLog::ReadMordentLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToMordentLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToMordentLogForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("long")) {
-        this->SetLong(StrToBoolean(element.attribute("long").value()));
-        if (removeAttr) element.remove_attribute("long");
+    if (pugi::xml_attribute attr = element.attribute("long")) {
+        this->SetLong(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -94,9 +95,10 @@ void AttOrnamPresent::ResetOrnamPresent()
 bool AttOrnamPresent::ReadOrnamPresent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ornam")) {
-        this->SetOrnam(StrToStr(element.attribute("ornam").value()));
-        if (removeAttr) element.remove_attribute("ornam");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("ornam")) {
+        this->SetOrnam(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -135,14 +137,15 @@ void AttOrnamentAccid::ResetOrnamentAccid()
 bool AttOrnamentAccid::ReadOrnamentAccid(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("accidupper")) {
-        this->SetAccidupper(StrToAccidentalWritten(element.attribute("accidupper").value()));
-        if (removeAttr) element.remove_attribute("accidupper");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("accidupper")) {
+        this->SetAccidupper(StrToAccidentalWritten(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("accidlower")) {
-        this->SetAccidlower(StrToAccidentalWritten(element.attribute("accidlower").value()));
-        if (removeAttr) element.remove_attribute("accidlower");
+    if (pugi::xml_attribute attr = element.attribute("accidlower")) {
+        this->SetAccidlower(StrToAccidentalWritten(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -190,14 +193,15 @@ void AttTurnLog::ResetTurnLog()
 bool AttTurnLog::ReadTurnLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("delayed")) {
-        this->SetDelayed(StrToBoolean(element.attribute("delayed").value()));
-        if (removeAttr) element.remove_attribute("delayed");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("delayed")) {
+        this->SetDelayed(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("form")) {
-        this->SetForm(StrToTurnLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToTurnLogForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,9 +39,10 @@ void AttCrit::ResetCrit()
 bool AttCrit::ReadCrit(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("cause")) {
-        this->SetCause(StrToStr(element.attribute("cause").value()));
-        if (removeAttr) element.remove_attribute("cause");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("cause")) {
+        this->SetCause(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
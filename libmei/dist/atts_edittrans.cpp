@@ -39,9 +39,10 @@ void AttAgentIdent::ResetAgentIdent()
 bool AttAgentIdent::ReadAgentIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("agent")) {
-        this->SetAgent(StrToStr(element.attribute("agent").value()));
-        if (removeAttr) element.remove_attribute("agent");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("agent")) {
+        this->SetAgent(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -79,9 +80,10 @@ void AttReasonIdent::ResetReasonIdent()
 bool AttReasonIdent::ReadReasonIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("reason")) {
-        this->SetReason(StrToStr(element.attribute("reason").value()));
-        if (removeAttr) element.remove_attribute("reason");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("reason")) {
+        this->SetReason(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -40,14 +40,15 @@ void AttExtSymAuth::ResetExtSymAuth()
 bool AttExtSymAuth::ReadExtSymAuth(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("glyph.auth")) {
-        this->SetGlyphAuth(StrToStr(element.attribute("glyph.auth").value()));
-        if (removeAttr) element.remove_attribute("glyph.auth");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("glyph.auth")) {
+        this->SetGlyphAuth(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("glyph.uri")) {
-        this->SetGlyphUri(StrToStr(element.attribute("glyph.uri").value()));
-        if (removeAttr) element.remove_attribute("glyph.uri");
+    if (pugi::xml_attribute attr = element.attribute("glyph.uri")) {
+        this->SetGlyphUri(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -95,14 +96,15 @@ void AttExtSymNames::ResetExtSymNames()
 bool AttExtSymNames::ReadExtSymNames(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("glyph.name")) {
-        this->SetGlyphName(StrToStr(element.attribute("glyph.name").value()));
-        if (removeAttr) element.remove_attribute("glyph.name");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("glyph.name")) {
+        this->SetGlyphName(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("glyph.num")) {
-        this->SetGlyphNum(StrToHexnum(element.attribute("glyph.num").value()));
-        if (removeAttr) element.remove_attribute("glyph.num");
+    if (pugi::xml_attribute attr = element.attribute("glyph.num")) {
+        this->SetGlyphNum(StrToHexnum(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,9 +39,10 @@ void AttAdlibitum::ResetAdlibitum()
 bool AttAdlibitum::ReadAdlibitum(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("adlib")) {
-        this->SetAdlib(StrToBoolean(element.attribute("adlib").value()));
-        if (removeAttr) element.remove_attribute("adlib");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("adlib")) {
+        this->SetAdlib(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -82,24 +83,25 @@ void AttBifoliumSurfaces::ResetBifoliumSurfaces()
 bool AttBifoliumSurfaces::ReadBifoliumSurfaces(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("outer.recto")) {
-        this->SetOuterRecto(StrToStr(element.attribute("outer.recto").value()));
-        if (removeAttr) element.remove_attribute("outer.recto");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("outer.recto")) {
+        this->SetOuterRecto(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("inner.verso")) {
-        this->SetInnerVerso(StrToStr(element.attribute("inner.verso").value()));
-        if (removeAttr) element.remove_attribute("inner.verso");
+    if (pugi::xml_attribute attr = element.attribute("inner.verso")) {
+        this->SetInnerVerso(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("inner.recto")) {
-        this->SetInnerRecto(StrToStr(element.attribute("inner.recto").value()));
-        if (removeAttr) element.remove_attribute("inner.recto");
+    if (pugi::xml_attribute attr = element.attribute("inner.recto")) {
+        this->SetInnerRecto(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("outer.verso")) {
-        this->SetOuterVerso(StrToStr(element.attribute("outer.verso").value()));
-        if (removeAttr) element.remove_attribute("outer.verso");
+    if (pugi::xml_attribute attr = element.attribute("outer.verso")) {
+        this->SetOuterVerso(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -165,14 +167,15 @@ void AttFoliumSurfaces::ResetFoliumSurfaces()
 bool AttFoliumSurfaces::ReadFoliumSurfaces(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("recto")) {
-        this->SetRecto(StrToStr(element.attribute("recto").value()));
-        if (removeAttr) element.remove_attribute("recto");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("recto")) {
+        this->SetRecto(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("verso")) {
-        this->SetVerso(StrToStr(element.attribute("verso").value()));
-        if (removeAttr) element.remove_attribute("verso");
+    if (pugi::xml_attribute attr = element.attribute("verso")) {
+        this->SetVerso(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -219,9 +222,10 @@ void AttPerfRes::ResetPerfRes()
 bool AttPerfRes::ReadPerfRes(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("solo")) {
-        this->SetSolo(StrToBoolean(element.attribute("solo").value()));
-        if (removeAttr) element.remove_attribute("solo");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("solo")) {
+        this->SetSolo(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -259,9 +263,10 @@ void AttPerfResBasic::ResetPerfResBasic()
 bool AttPerfResBasic::ReadPerfResBasic(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("count")) {
-        this->SetCount(StrToInt(element.attribute("count").value()));
-        if (removeAttr) element.remove_attribute("count");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("count")) {
+        this->SetCount(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -299,9 +304,10 @@ void AttRecordType::ResetRecordType()
 bool AttRecordType::ReadRecordType(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("recordtype")) {
-        this->SetRecordtype(StrToRecordTypeRecordtype(element.attribute("recordtype").value()));
-        if (removeAttr) element.remove_attribute("recordtype");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("recordtype")) {
+        this->SetRecordtype(StrToRecordTypeRecordtype(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -339,9 +345,10 @@ void AttRegularMethod::ResetRegularMethod()
 bool AttRegularMethod::ReadRegularMethod(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("method")) {
-        this->SetMethod(StrToRegularMethodMethod(element.attribute("method").value()));
-        if (removeAttr) element.remove_attribute("method");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("method")) {
+        this->SetMethod(StrToRegularMethodMethod(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
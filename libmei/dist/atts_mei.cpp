@@ -40,14 +40,15 @@ void AttNotationType::ResetNotationType()
 bool AttNotationType::ReadNotationType(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("notationtype")) {
-        this->SetNotationtype(StrToNotationtype(element.attribute("notationtype").value()));
-        if (removeAttr) element.remove_attribute("notationtype");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("notationtype")) {
+        this->SetNotationtype(StrToNotationtype(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("notationsubtype")) {
-        this->SetNotationsubtype(StrToStr(element.attribute("notationsubtype").value()));
-        if (removeAttr) element.remove_attribute("notationsubtype");
+    if (pugi::xml_attribute attr = element.attribute("notationsubtype")) {
+        this->SetNotationsubtype(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
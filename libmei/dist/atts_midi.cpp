@@ -42,24 +42,25 @@ void AttChannelized::ResetChannelized()
 bool AttChannelized::ReadChannelized(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.channel")) {
-        this->SetMidiChannel(StrToMidichannel(element.attribute("midi.channel").value()));
-        if (removeAttr) element.remove_attribute("midi.channel");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("midi.channel")) {
+        this->SetMidiChannel(StrToMidichannel(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.duty")) {
-        this->SetMidiDuty(StrToPercentLimited(element.attribute("midi.duty").value()));
-        if (removeAttr) element.remove_attribute("midi.duty");
+    if (pugi::xml_attribute attr = element.attribute("midi.duty")) {
+        this->SetMidiDuty(StrToPercentLimited(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.port")) {
-        this->SetMidiPort(StrToMidivalueName(element.attribute("midi.port").value()));
-        if (removeAttr) element.remove_attribute("midi.port");
+    if (pugi::xml_attribute attr = element.attribute("midi.port")) {
+        this->SetMidiPort(StrToMidivalueName(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.track")) {
-        this->SetMidiTrack(StrToInt(element.attribute("midi.track").value()));
-        if (removeAttr) element.remove_attribute("midi.track");
+    if (pugi::xml_attribute attr = element.attribute("midi.track")) {
+        this->SetMidiTrack(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -124,9 +125,10 @@ void AttInstrumentIdent::ResetInstrumentIdent()
 bool AttInstrumentIdent::ReadInstrumentIdent(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("instr")) {
-        this->SetInstr(StrToStr(element.attribute("instr").value()));
-        if (removeAttr) element.remove_attribute("instr");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("instr")) {
+        this->SetInstr(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -169,34 +171,35 @@ void AttMidiInstrument::ResetMidiInstrument()
 bool AttMidiInstrument::ReadMidiInstrument(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.instrnum")) {
-        this->SetMidiInstrnum(StrToMidivalue(element.attribute("midi.instrnum").value()));
-        if (removeAttr) element.remove_attribute("midi.instrnum");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("midi.instrnum")) {
+        this->SetMidiInstrnum(StrToMidivalue(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.instrname")) {
-        this->SetMidiInstrname(StrToMidinames(element.attribute("midi.instrname").value()));
-        if (removeAttr) element.remove_attribute("midi.instrname");
+    if (pugi::xml_attribute attr = element.attribute("midi.instrname")) {
+        this->SetMidiInstrname(StrToMidinames(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.pan")) {
-        this->SetMidiPan(StrToMidivaluePan(element.attribute("midi.pan").value()));
-        if (removeAttr) element.remove_attribute("midi.pan");
+    if (pugi::xml_attribute attr = element.attribute("midi.pan")) {
+        this->SetMidiPan(StrToMidivaluePan(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.patchname")) {
-        this->SetMidiPatchname(StrToStr(element.attribute("midi.patchname").value()));
-        if (removeAttr) element.remove_attribute("midi.patchname");
+    if (pugi::xml_attribute attr = element.attribute("midi.patchname")) {
+        this->SetMidiPatchname(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.patchnum")) {
-        this->SetMidiPatchnum(StrToMidivalue(element.attribute("midi.patchnum").value()));
-        if (removeAttr) element.remove_attribute("midi.patchnum");
+    if (pugi::xml_attribute attr = element.attribute("midi.patchnum")) {
+        this->SetMidiPatchnum(StrToMidivalue(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.volume")) {
-        this->SetMidiVolume(StrToPercent(element.attribute("midi.volume").value()));
-        if (removeAttr) element.remove_attribute("midi.volume");
+    if (pugi::xml_attribute attr = element.attribute("midi.volume")) {
+        this->SetMidiVolume(StrToPercent(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -279,9 +282,10 @@ void AttMidiNumber::ResetMidiNumber()
 bool AttMidiNumber::ReadMidiNumber(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("num")) {
-        this->SetNum(StrToMidivalue(element.attribute("num").value()));
-        if (removeAttr) element.remove_attribute("num");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("num")) {
+        this->SetNum(StrToMidivalue(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -320,14 +324,15 @@ void AttMidiTempo::ResetMidiTempo()
 bool AttMidiTempo::ReadMidiTempo(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("midi.bpm")) {
-        this->SetMidiBpm(StrToDbl(element.attribute("midi.bpm").value()));
-        if (removeAttr) element.remove_attribute("midi.bpm");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("midi.bpm")) {
+        this->SetMidiBpm(StrToDbl(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("midi.mspb")) {
-        this->SetMidiMspb(StrToMidimspb(element.attribute("midi.mspb").value()));
-        if (removeAttr) element.remove_attribute("midi.mspb");
+    if (pugi::xml_attribute attr = element.attribute("midi.mspb")) {
+        this->SetMidiMspb(StrToMidimspb(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -374,9 +379,10 @@ void AttMidiValue::ResetMidiValue()
 bool AttMidiValue::ReadMidiValue(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("val")) {
-        this->SetVal(StrToMidivalue(element.attribute("val").value()));
-        if (removeAttr) element.remove_attribute("val");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("val")) {
+        this->SetVal(StrToMidivalue(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -414,9 +420,10 @@ void AttMidiValue2::ResetMidiValue2()
 bool AttMidiValue2::ReadMidiValue2(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("val2")) {
-        this->SetVal2(StrToMidivalue(element.attribute("val2").value()));
-        if (removeAttr) element.remove_attribute("val2");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("val2")) {
+        this->SetVal2(StrToMidivalue(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -454,9 +461,10 @@ void AttMidiVelocity::ResetMidiVelocity()
 bool AttMidiVelocity::ReadMidiVelocity(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("vel")) {
-        this->SetVel(StrToMidivalue(element.attribute("vel").value()));
-        if (removeAttr) element.remove_attribute("vel");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("vel")) {
+        this->SetVel(StrToMidivalue(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -494,9 +502,10 @@ void AttTimeBase::ResetTimeBase()
 bool AttTimeBase::ReadTimeBase(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("ppq")) {
-        this->SetPpq(StrToInt(element.attribute("ppq").value()));
-        if (removeAttr) element.remove_attribute("ppq");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("ppq")) {
+        this->SetPpq(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -39,9 +39,10 @@ void AttDivLineLog::ResetDivLineLog()
 bool AttDivLineLog::ReadDivLineLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("form")) {
-        this->SetForm(StrToDivLineLogForm(element.attribute("form").value()));
-        if (removeAttr) element.remove_attribute("form");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("form")) {
+        this->SetForm(StrToDivLineLogForm(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -80,14 +81,15 @@ void AttNcLog::ResetNcLog()
 bool AttNcLog::ReadNcLog(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("oct")) {
-        this->SetOct(StrToStr(element.attribute("oct").value()));
-        if (removeAttr) element.remove_attribute("oct");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("oct")) {
+        this->SetOct(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("pname")) {
-        this->SetPname(StrToStr(element.attribute("pname").value()));
-        if (removeAttr) element.remove_attribute("pname");
+    if (pugi::xml_attribute attr = element.attribute("pname")) {
+        this->SetPname(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -140,39 +142,40 @@ void AttNcForm::ResetNcForm()
 bool AttNcForm::ReadNcForm(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("angled")) {
-        this->SetAngled(StrToBoolean(element.attribute("angled").value()));
-        if (removeAttr) element.remove_attribute("angled");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("angled")) {
+        this->SetAngled(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("con")) {
-        this->SetCon(StrToNcFormCon(element.attribute("con").value()));
-        if (removeAttr) element.remove_attribute("con");
+    if (pugi::xml_attribute attr = element.attribute("con")) {
+        this->SetCon(StrToNcFormCon(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("hooked")) {
-        this->SetHooked(StrToBoolean(element.attribute("hooked").value()));
-        if (removeAttr) element.remove_attribute("hooked");
+    if (pugi::xml_attribute attr = element.attribute("hooked")) {
+        this->SetHooked(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("ligated")) {
-        this->SetLigated(StrToBoolean(element.attribute("ligated").value()));
-        if (removeAttr) element.remove_attribute("ligated");
+    if (pugi::xml_attribute attr = element.attribute("ligated")) {
+        this->SetLigated(StrToBoolean(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("rellen")) {
-        this->SetRellen(StrToNcFormRellen(element.attribute("rellen").value()));
-        if (removeAttr) element.remove_attribute("rellen");
+    if (pugi::xml_attribute attr = element.attribute("rellen")) {
+        this->SetRellen(StrToNcFormRellen(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("sShape")) {
-        this->SetSShape(StrToStr(element.attribute("sShape").value()));
-        if (removeAttr) element.remove_attribute("sShape");
+    if (pugi::xml_attribute attr = element.attribute("sShape")) {
+        this->SetSShape(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tilt")) {
-        this->SetTilt(StrToCompassdirection(element.attribute("tilt").value()));
-        if (removeAttr) element.remove_attribute("tilt");
+    if (pugi::xml_attribute attr = element.attribute("tilt")) {
+        this->SetTilt(StrToCompassdirection(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -264,9 +267,10 @@ void AttNeumeType::ResetNeumeType()
 bool AttNeumeType::ReadNeumeType(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("type")) {
-        this->SetType(StrToStr(element.attribute("type").value()));
-        if (removeAttr) element.remove_attribute("type");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("type")) {
+        this->SetType(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -42,24 +42,25 @@ void AttMargins::ResetMargins()
 bool AttMargins::ReadMargins(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("topmar")) {
-        this->SetTopmar(StrToMeasurementunsigned(element.attribute("topmar").value()));
-        if (removeAttr) element.remove_attribute("topmar");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("topmar")) {
+        this->SetTopmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("botmar")) {
-        this->SetBotmar(StrToMeasurementunsigned(element.attribute("botmar").value()));
-        if (removeAttr) element.remove_attribute("botmar");
+    if (pugi::xml_attribute attr = element.attribute("botmar")) {
+        this->SetBotmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("leftmar")) {
-        this->SetLeftmar(StrToMeasurementunsigned(element.attribute("leftmar").value()));
-        if (removeAttr) element.remove_attribute("leftmar");
+    if (pugi::xml_attribute attr = element.attribute("leftmar")) {
+        this->SetLeftmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("rightmar")) {
-        this->SetRightmar(StrToMeasurementunsigned(element.attribute("rightmar").value()));
-        if (removeAttr) element.remove_attribute("rightmar");
+    if (pugi::xml_attribute attr = element.attribute("rightmar")) {
+        this->SetRightmar(StrToMeasurementunsigned(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
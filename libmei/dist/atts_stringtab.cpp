@@ -40,14 +40,15 @@ void AttStaffDefVisTablature::ResetStaffDefVisTablature()
 bool AttStaffDefVisTablature::ReadStaffDefVisTablature(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.align")) {
-        this->SetTabAlign(StrToVerticalalignment(element.attribute("tab.align").value()));
-        if (removeAttr) element.remove_attribute("tab.align");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("tab.align")) {
+        this->SetTabAlign(StrToVerticalalignment(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tab.anchorline")) {
-        this->SetTabAnchorline(StrToInt(element.attribute("tab.anchorline").value()));
-        if (removeAttr) element.remove_attribute("tab.anchorline");
+    if (pugi::xml_attribute attr = element.attribute("tab.anchorline")) {
+        this->SetTabAnchorline(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -98,29 +99,30 @@ void AttStringtab::ResetStringtab()
 bool AttStringtab::ReadStringtab(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.fing")) {
-        this->SetTabFing(StrToStr(element.attribute("tab.fing").value()));
-        if (removeAttr) element.remove_attribute("tab.fing");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("tab.fing")) {
+        this->SetTabFing(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tab.fret")) {
-        this->SetTabFret(StrToInt(element.attribute("tab.fret").value()));
-        if (removeAttr) element.remove_attribute("tab.fret");
+    if (pugi::xml_attribute attr = element.attribute("tab.fret")) {
+        this->SetTabFret(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tab.line")) {
-        this->SetTabLine(StrToInt(element.attribute("tab.line").value()));
-        if (removeAttr) element.remove_attribute("tab.line");
+    if (pugi::xml_attribute attr = element.attribute("tab.line")) {
+        this->SetTabLine(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tab.string")) {
-        this->SetTabString(StrToStr(element.attribute("tab.string").value()));
-        if (removeAttr) element.remove_attribute("tab.string");
+    if (pugi::xml_attribute attr = element.attribute("tab.string")) {
+        this->SetTabString(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tab.course")) {
-        this->SetTabCourse(StrToInt(element.attribute("tab.course").value()));
-        if (removeAttr) element.remove_attribute("tab.course");
+    if (pugi::xml_attribute attr = element.attribute("tab.course")) {
+        this->SetTabCourse(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -194,9 +196,10 @@ void AttStringtabPosition::ResetStringtabPosition()
 bool AttStringtabPosition::ReadStringtabPosition(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.pos")) {
-        this->SetTabPos(StrToInt(element.attribute("tab.pos").value()));
-        if (removeAttr) element.remove_attribute("tab.pos");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("tab.pos")) {
+        this->SetTabPos(StrToInt(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -235,14 +238,15 @@ void AttStringtabTuning::ResetStringtabTuning()
 bool AttStringtabTuning::ReadStringtabTuning(pugi::xml_node element, bool removeAttr)
 {
     bool hasAttribute = false;
-    if (element.attribute("tab.strings")) {
-        this->SetTabStrings(StrToStr(element.attribute("tab.strings").value()));
-        if (removeAttr) element.remove_attribute("tab.strings");
+    if (!element.first_attribute()) return hasAttribute;
+    if (pugi::xml_attribute attr = element.attribute("tab.strings")) {
+        this->SetTabStrings(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
-    if (element.attribute("tab.courses")) {
-        this->SetTabCourses(StrToStr(element.attribute("tab.courses").value()));
-        if (removeAttr) element.remove_attribute("tab.courses");
+    if (pugi::xml_attribute attr = element.attribute("tab.courses")) {
+        this->SetTabCourses(StrToStr(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }
     return hasAttribute;
@@ -152,6 +152,7 @@ void Att{attGroupNameUpper}::Reset{attGroupNameUpper}()
 bool Att{attGroupNameUpper}::Read{attGroupNameUpper}(pugi::xml_node element, bool removeAttr)
 {{
     bool hasAttribute = false;
+    if (!element.first_attribute()) return hasAttribute;
     {reads}
     return hasAttribute;
 }}
@@ -168,9 +169,9 @@ bool Att{attGroupNameUpper}::Write{attGroupNameUpper}(pugi::xml_node element)
 
 ATTCLASS_MEMBERS_DEFAULT_CPP = """m_{attNameLowerJoined} = {attDefault};"""
 
-ATTCLASS_READ_CPP = """if (element.attribute("{attNameLower}")) {{
-        this->Set{attNameUpper}({converterRead}(element.attribute("{attNameLower}").value()));
-        if (removeAttr) element.remove_attribute("{attNameLower}");
+ATTCLASS_READ_CPP = """if (pugi::xml_attribute attr = element.attribute("{attNameLower}")) {{
+        this->Set{attNameUpper}({converterRead}(attr.value()));
+        if (removeAttr) element.remove_attribute(attr);
         hasAttribute = true;
     }}"""
 
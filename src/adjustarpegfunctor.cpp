@@ -24,6 +24,8 @@ namespace vrv {
 AdjustArpegFunctor::AdjustArpegFunctor(Doc *doc) : DocFunctor(doc)
 {
     m_measureAligner = NULL;
+
+    this->SetClassIds({ ALIGNMENT, ARPEG, MEASURE });
 }
 
 FunctorCode AdjustArpegFunctor::VisitAlignment(Alignment *alignment)
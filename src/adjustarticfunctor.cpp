@@ -151,7 +151,10 @@ FunctorCode AdjustArticFunctor::VisitNote(Note *note)
 // AdjustArticWithSlursFunctor
 //----------------------------------------------------------------------------
 
-AdjustArticWithSlursFunctor::AdjustArticWithSlursFunctor(Doc *doc) : DocFunctor(doc) {}
+AdjustArticWithSlursFunctor::AdjustArticWithSlursFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetClassIds({ ARTIC });
+}
 
 FunctorCode AdjustArticWithSlursFunctor::VisitArtic(Artic *artic)
 {
@@ -24,6 +24,8 @@ namespace vrv {
 AdjustClefChangesFunctor::AdjustClefChangesFunctor(Doc *doc) : DocFunctor(doc)
 {
     m_aligner = NULL;
+
+    this->SetClassIds({ CLEF, MEASURE });
 }
 
 FunctorCode AdjustClefChangesFunctor::VisitClef(Clef *clef)
@@ -30,6 +30,8 @@ AdjustHarmGrpsSpacingFunctor::AdjustHarmGrpsSpacingFunctor(Doc *doc) : DocFuncto
     m_previousHarmStart = NULL;
     m_previousMeasure = NULL;
     m_currentSystem = NULL;
+
+    this->SetClassIds({ HARM, MEASURE, SYSTEM });
 }
 
 FunctorCode AdjustHarmGrpsSpacingFunctor::VisitHarm(Harm *harm)
@@ -24,6 +24,8 @@ namespace vrv {
 AdjustTempoFunctor::AdjustTempoFunctor(Doc *doc) : DocFunctor(doc)
 {
     m_systemAligner = NULL;
+
+    this->SetClassIds({ SYSTEM, TEMPO });
 }
 
 FunctorCode AdjustTempoFunctor::VisitSystem(System *system)
@@ -20,7 +20,10 @@ namespace vrv {
 // AdjustTupletsXFunctor
 //----------------------------------------------------------------------------
 
-AdjustTupletsXFunctor::AdjustTupletsXFunctor(Doc *doc) : DocFunctor(doc) {}
+AdjustTupletsXFunctor::AdjustTupletsXFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetClassIds({ TUPLET });
+}
 
 FunctorCode AdjustTupletsXFunctor::VisitTuplet(Tuplet *tuplet)
 {
@@ -25,7 +25,10 @@ namespace vrv {
 // AdjustTupletsYFunctor
 //----------------------------------------------------------------------------
 
-AdjustTupletsYFunctor::AdjustTupletsYFunctor(Doc *doc) : DocFunctor(doc) {}
+AdjustTupletsYFunctor::AdjustTupletsYFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetClassIds({ TUPLET });
+}
 
 FunctorCode AdjustTupletsYFunctor::VisitTuplet(Tuplet *tuplet)
 {
@@ -371,7 +374,10 @@ FunctorCode AdjustTupletNumOverlapFunctor::VisitLayerElement(const LayerElement
 // AdjustTupletWithSlursFunctor
 //----------------------------------------------------------------------------
 
-AdjustTupletWithSlursFunctor::AdjustTupletWithSlursFunctor(Doc *doc) : DocFunctor(doc) {}
+AdjustTupletWithSlursFunctor::AdjustTupletWithSlursFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetClassIds({ TUPLET });
+}
 
 FunctorCode AdjustTupletWithSlursFunctor::VisitTuplet(Tuplet *tuplet)
 {
@@ -67,7 +67,10 @@ FunctorCode AdjustYPosFunctor::VisitSystem(System *system)
 // AdjustCrossStaffYPosFunctor
 //----------------------------------------------------------------------------
 
-AdjustCrossStaffYPosFunctor::AdjustCrossStaffYPosFunctor(Doc *doc) : DocFunctor(doc) {}
+AdjustCrossStaffYPosFunctor::AdjustCrossStaffYPosFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetClassIds({ CHORD, SYSTEM });
+}
 
 FunctorCode AdjustCrossStaffYPosFunctor::VisitChord(Chord *chord)
 {
@@ -47,6 +47,11 @@ bool BoundingBox::Is(const std::vector<ClassId> &classIds) const
     return (std::find(classIds.begin(), classIds.end(), this->GetClassId()) != classIds.end());
 }
 
+bool BoundingBox::Is(std::initializer_list<ClassId> classIds) const
+{
+    return (std::find(classIds.begin(), classIds.end(), this->GetClassId()) != classIds.end());
+}
+
 void BoundingBox::UpdateContentBBoxX(int x1, int x2)
 {
     // LogDebug("CB Was: %i %i %i %i", m_contentBB_x1, m_contentBB_y1, m_contentBB_x2, m_contentBB_y2);
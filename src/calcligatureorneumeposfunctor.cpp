@@ -23,7 +23,10 @@ namespace vrv {
 // CalcLigatureOrNeumePosFunctor
 //----------------------------------------------------------------------------
 
-CalcLigatureOrNeumePosFunctor::CalcLigatureOrNeumePosFunctor(Doc *doc) : DocFunctor(doc) {}
+CalcLigatureOrNeumePosFunctor::CalcLigatureOrNeumePosFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetClassIds({ LIGATURE, NEUME });
+}
 
 FunctorCode CalcLigatureOrNeumePosFunctor::VisitLigature(Ligature *ligature)
 {
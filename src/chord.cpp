@@ -202,6 +202,7 @@ bool Chord::AddChild(Object *child)
     else {
         children.push_back(child);
     }
+    this->IndexChild(child);
     this->Modify();
 
     return true;
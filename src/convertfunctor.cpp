@@ -17,15 +17,19 @@
 #include "fermata.h"
 #include "layer.h"
 #include "ligature.h"
+#include "linkinginterface.h"
 #include "mdiv.h"
 #include "mrest.h"
 #include "page.h"
+#include "pagemilestone.h"
+#include "pages.h"
 #include "rest.h"
 #include "score.h"
 #include "section.h"
 #include "staff.h"
 #include "syllable.h"
 #include "system.h"
+#include "systemmilestone.h"
 #include "text.h"
 #include "tie.h"
 #include "tuplet.h"
@@ -161,6 +165,118 @@ FunctorCode ConvertToPageBasedFunctor::VisitSystemElement(SystemElement *systemE
     return FUNCTOR_CONTINUE;
 }
 
+//----------------------------------------------------------------------------
+// ConvertToScoreBasedFunctor
+//----------------------------------------------------------------------------
+
+ConvertToScoreBasedFunctor::ConvertToScoreBasedFunctor(Doc *targetDoc) : ConstFunctor()
+{
+    assert(targetDoc);
+    m_containers.push_back(targetDoc);
+}
+
+FunctorCode ConvertToScoreBasedFunctor::VisitDiv(const Div *div)
+{
+    // Text layout elements cannot be copied and are not needed in the score-based tree
+    return FUNCTOR_SIBLINGS;
+}
+
+FunctorCode ConvertToScoreBasedFunctor::VisitDoc(const Doc *doc)
+{
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode ConvertToScoreBasedFunctor::VisitObject(const Object *object)
+{
+    assert(!m_containers.empty());
+
+    Object *copy = object->Clone();
+    if (!copy) return FUNCTOR_SIBLINGS;
+    copy->CloneReset();
+    this->RestoreIDs(object, copy);
+
+    // A milestone start has no children and its copy becomes the container of what follows until its end
+    const bool isMilestone = object->IsMilestoneElement();
+    if (isMilestone) {
+        if (object->Is({ MDIV, SCORE })) {
+            PageMilestoneInterface *interface = dynamic_cast<PageMilestoneInterface *>(copy);
+            assert(interface);
+            interface->ConvertToScoreBasedContainer();
+        }
+        else {
+            SystemMilestoneInterface *interface = dynamic_cast<SystemMilestoneInterface *>(copy);
+            assert(interface);
+            interface->ConvertToScoreBasedContainer();
+        }
+    }
+
+    m_containers.back()->AddChild(copy);
+    if (isMilestone) m_containers.push_back(copy);
+
+    return FUNCTOR_SIBLINGS;
+}
+
+FunctorCode ConvertToScoreBasedFunctor::VisitPage(const Page *page)
+{
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode ConvertToScoreBasedFunctor::VisitPageMilestone(const PageMilestoneEnd *pageMilestoneEnd)
+{
+    assert(m_containers.size() > 1);
+    m_containers.pop_back();
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode ConvertToScoreBasedFunctor::VisitPages(const Pages *pages)
+{
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode ConvertToScoreBasedFunctor::VisitSystem(const System *system)
+{
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode ConvertToScoreBasedFunctor::VisitSystemMilestone(const SystemMilestoneEnd *systemMilestoneEnd)
+{
+    assert(m_containers.size() > 1);
+    m_containers.pop_back();
+
+    return FUNCTOR_CONTINUE;
+}
+
+void ConvertToScoreBasedFunctor::RestoreIDs(const Object *object, Object *copy) const
+{
+    assert(object && copy);
+    assert(object->GetClassId() == copy->GetClassId());
+
+    copy->SetID(object->GetID());
+    // Undo the back link to the original added when copying children
+    LinkingInterface *link = copy->GetLinkingInterface();
+    const LinkingInterface *originalLink = object->GetLinkingInterface();
+    if (link && originalLink && !originalLink->HasCorresp()) link->SetCorresp("");
+
+    if (object->Is(SCORE)) {
+        const Object *subtree = vrv_cast<const Score *>(object)->GetScoreDefSubtree();
+        Object *subtreeCopy = vrv_cast<Score *>(copy)->GetScoreDefSubtree();
+        if (subtree && subtreeCopy) this->RestoreIDs(subtree, subtreeCopy);
+    }
+
+    // Children that cannot be copied (e.g., running elements) are missing in the copy
+    // Since this depends only on the class, matching the class ids is enough to pair them
+    int copyIdx = 0;
+    for (int i = 0; i < object->GetChildCount(); ++i) {
+        const Object *child = object->GetChild(i);
+        Object *copyChild = copy->GetChild(copyIdx);
+        if (!copyChild) break;
+        if (copyChild->GetClassId() != child->GetClassId()) continue;
+        this->RestoreIDs(child, copyChild);
+        ++copyIdx;
+    }
+}
+
 //----------------------------------------------------------------------------
 // ConvertToCastOffMensuralFunctor
 //----------------------------------------------------------------------------
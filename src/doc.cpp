@@ -96,12 +96,19 @@ Doc::Doc() : Object(DOC)
     m_focusRange = NULL;
 
     this->Reset();
+
+    // The document is the root of its ID index
+    this->AddToIDIndex(this);
 }
 
 Doc::~Doc()
 {
     this->ClearSelectionPages();
 
+    // Delete the children before the ID index they are removing themselves from
+    this->ClearChildren();
+    this->RemoveFromIDIndex();
+
     delete m_options;
     if (m_focusRange) delete m_focusRange;
 }
@@ -148,6 +155,7 @@ void Doc::ResetToSerialization()
     m_currentScoreDefDone = false;
     m_dataPreparationDone = false;
     m_timemapTempo = 0.0;
+    m_timemapIndex.Reset();
     m_markup = MARKUP_DEFAULT;
     m_isMensuralMusicOnly = BOOLEAN_NONE;
     m_isNeumeLines = false;
@@ -386,19 +394,23 @@ bool Doc::HasTimemap() const
 
 void Doc::CalculateTimemap()
 {
+    ProfileScope profileScope(this->GetProfiler(), "CalculateTimemap");
+
     // There is no data to calculate the timemap
     if (this->GetPageCount() == 0) {
         return;
     }
 
     m_timemapTempo = 0.0;
+    m_timemapIndex.Reset();
 
     // This happens if the document was never cast off (breaks none option in the toolkit)
+    // Only the timing of the alignments is needed, so there is no need for a horizontal layout
     if (!m_drawingPage) {
         Page *page = this->SetDrawingPage(0);
         assert(page);
         this->ScoreDefSetCurrentDoc();
-        page->LayOutHorizontally();
+        page->ResetTemporalAligners();
     }
 
     double tempo = MIDI_TEMPO;
@@ -434,10 +446,27 @@ void Doc::CalculateTimemap()
     this->Process(initTimemapAdjustNotes);
 
     m_timemapTempo = m_options->m_midiTempoAdjustment.GetValue();
+
+    // Index the measures, notes and rests by time
+    m_timemapIndex.Build(this);
+}
+
+const TimemapIndex &Doc::GetTimemapIndex()
+{
+    if (!this->HasTimemap()) {
+        // generate MIDI timemap before progressing
+        this->CalculateTimemap();
+    }
+    if (!m_timemapIndex.IsBuilt()) {
+        m_timemapIndex.Build(this);
+    }
+    return m_timemapIndex;
 }
 
 void Doc::ExportMIDI(smf::MidiFile *midiFile)
 {
+    ProfileScope profileScope(this->GetProfiler(), "ExportMIDI");
+
     midiFile->absoluteTicks();
 
     if (!this->HasTimemap()) {
@@ -480,6 +509,9 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
     // The tree is used to process each staff/layer/verse separately
     // For this, we use a array of AttNIntegerComparison that looks for each object if it is of the type
     // and with @n specified
+    // Instead of processing the whole document for each of them, only the objects collected by the InitMIDIFunctor
+    // are processed, i.e. the measures, the scoreDefs, the pedals and the staves with the matching @n
+    const ListOfConstObjects &trackObjects = initMIDI.GetTrackObjects();
 
     // Process notes and chords, rests, spaces layer by layer
     // track 0 (included by default) is reserved for meta messages common to all tracks
@@ -581,7 +613,18 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
             generateMIDI.SetControlEvents(controlEvents);
 
             // LogDebug("Exporting track %d ----------------", midiTrack);
-            this->Process(generateMIDI);
+            for (const Object *object : trackObjects) {
+                if (object->Is(MEASURE)) {
+                    // Do not go deeper since the staves are in the list
+                    object->Process(generateMIDI, 0);
+                }
+                else if (object->Is(STAFF)) {
+                    if (vrv_cast<const Staff *>(object)->GetN() == staves.first) object->Process(generateMIDI);
+                }
+                else if (!object->Is(PEDAL) || controlEvents) {
+                    object->Process(generateMIDI);
+                }
+            }
 
             tempoEventTicks = generateMIDI.GetTempoEventTicks();
             // Process them only once per staff
@@ -643,6 +686,8 @@ bool Doc::ExportFeatures(std::string &output, const std::string &options)
 
 void Doc::PrepareData()
 {
+    ProfileScope profileScope(this->GetProfiler(), "PrepareData");
+
     Object *root = this;
     if (m_focusStatus != FOCUS_UNSET) {
         m_focusStatus = FOCUS_USED;
@@ -652,6 +697,8 @@ void Doc::PrepareData()
     /************ Reset and initialization ************/
 
     if (m_dataPreparationDone) {
+        // The elements indexed by time might have changed
+        m_timemapIndex.Reset();
         // Reset the scoreDef for the entire doc
         this->ResetToLoading();
         ResetDataFunctor resetData;
@@ -785,37 +832,14 @@ void Doc::PrepareData()
 
     /************ Prepare processing by staff/layer/verse ************/
 
-    // We need to populate processing lists for processing the document by Layer (for matching @tie) and
-    // by Verse (for matching syllable connectors)
-    InitProcessingListsFunctor initProcessingLists;
-
-    // We first fill a tree of ints with [staff/layer] and [staff/layer/verse] numbers (@n) to be processed
-    // LogElapsedTimeStart();
-    root->Process(initProcessingLists);
-    const IntTree &layerTree = initProcessingLists.GetLayerTree();
-    const IntTree &verseTree = initProcessingLists.GetVerseTree();
-
-    // The tree is used to process each staff/layer/verse separately
-    // For this, we use an array of AttNIntegerComparison that looks for each object if it is of the type
-    // and with @n specified
+    // The following functors process the document by Layer (for matching @tie) and by Verse (for matching
+    // syllable connectors). They keep their state by staff/layer/verse numbers (@n), so each of them needs
+    // a single traversal of the document.
 
     /************ Resolve some pointers by layer ************/
 
-    Filters filters;
-    for (auto &staves : layerTree.child) {
-        for (auto &layers : staves.second.child) {
-            filters.Clear();
-            // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves.first);
-            AttNIntegerComparison matchLayer(LAYER, layers.first);
-            filters.Add(&matchStaff);
-            filters.Add(&matchLayer);
-
-            PreparePointersByLayerFunctor preparePointersByLayer;
-            preparePointersByLayer.SetFilters(&filters);
-            root->Process(preparePointersByLayer);
-        }
-    }
+    PreparePointersByLayerFunctor preparePointersByLayer;
+    root->Process(preparePointersByLayer);
 
     /************ Resolve delayed turns ************/
 
@@ -824,46 +848,16 @@ void Doc::PrepareData()
     prepareDelayedTurns.SetDataCollectionCompleted();
 
     if (!prepareDelayedTurns.GetDelayedTurns().empty()) {
-        for (auto &staves : layerTree.child) {
-            for (auto &layers : staves.second.child) {
-                filters.Clear();
-                // Create ad comparison object for each type / @n
-                AttNIntegerComparison matchStaff(STAFF, staves.first);
-                AttNIntegerComparison matchLayer(LAYER, layers.first);
-                filters.Add(&matchStaff);
-                filters.Add(&matchLayer);
-
-                prepareDelayedTurns.SetFilters(&filters);
-                prepareDelayedTurns.ResetCurrent();
-                root->Process(prepareDelayedTurns);
-            }
-        }
+        root->Process(prepareDelayedTurns);
     }
 
     /************ Resolve lyric connectors ************/
 
-    // Same for the lyrics, but Verse by Verse since Syl are TimeSpanningInterface elements for handling connectors
-    for (auto &staves : verseTree.child) {
-        for (auto &layers : staves.second.child) {
-            for (auto &verses : layers.second.child) {
-                // std::cout << staves->first << " => " << layers->first << " => " << verses->first << '\n';
-                filters.Clear();
-                // Create ad comparison object for each type / @n
-                AttNIntegerComparison matchStaff(STAFF, staves.first);
-                AttNIntegerComparison matchLayer(LAYER, layers.first);
-                AttNIntegerComparison matchVerse(VERSE, verses.first);
-                filters.Add(&matchStaff);
-                filters.Add(&matchLayer);
-                filters.Add(&matchVerse);
-
-                // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
-                // m_drawingLastNote is set only if the syl has a forward connector
-                PrepareLyricsFunctor prepareLyrics;
-                prepareLyrics.SetFilters(&filters);
-                root->Process(prepareLyrics);
-            }
-        }
-    }
+    // Verse by verse since Syl are TimeSpanningInterface elements for handling connectors
+    // It sets m_drawingFirstNote and m_drawingLastNote for each syl
+    // m_drawingLastNote is set only if the syl has a forward connector
+    PrepareLyricsFunctor prepareLyrics;
+    root->Process(prepareLyrics);
 
     /************ Fill control event spanning ************/
 
@@ -881,22 +875,9 @@ void Doc::PrepareData()
 
     /************ Resolve mRpt ************/
 
-    // Process by staff for matching mRpt elements and setting the drawing number
-    for (auto &staves : layerTree.child) {
-        for (auto &layers : staves.second.child) {
-            filters.Clear();
-            // Create ad comparison object for each type / @n
-            AttNIntegerComparison matchStaff(STAFF, staves.first);
-            AttNIntegerComparison matchLayer(LAYER, layers.first);
-            filters.Add(&matchStaff);
-            filters.Add(&matchLayer);
-
-            // We set multiNumber to NONE for indicated we need to look at the staffDef when reaching the first staff
-            PrepareRptFunctor prepareRpt(this);
-            prepareRpt.SetFilters(&filters);
-            root->Process(prepareRpt);
-        }
-    }
+    // Process by staff/layer for matching mRpt elements and setting the drawing number
+    PrepareRptFunctor prepareRpt(this);
+    root->Process(prepareRpt);
 
     /************ Resolve endings ************/
 
@@ -954,6 +935,8 @@ void Doc::PrepareData()
 
 void Doc::ScoreDefSetCurrentDoc(bool force)
 {
+    ProfileScope profileScope(this->GetProfiler(), "ScoreDefSetCurrentDoc");
+
     if (m_currentScoreDefDone && !force) {
         return;
     }
@@ -1013,6 +996,8 @@ void Doc::CastOffSmartDoc()
 
 void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
 {
+    ProfileScope profileScope(this->GetProfiler(), "CastOffDoc");
+
     Pages *pages = this->GetPages();
     assert(pages);
 
@@ -1122,6 +1107,8 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
 
 void Doc::UnCastOffDoc(bool resetCache)
 {
+    ProfileScope profileScope(this->GetProfiler(), "UnCastOffDoc");
+
     if (!this->IsCastOff()) {
         LogDebug("Document is not cast off");
         return;
@@ -1153,6 +1140,8 @@ void Doc::UnCastOffDoc(bool resetCache)
 
 void Doc::CastOffEncodingDoc()
 {
+    ProfileScope profileScope(this->GetProfiler(), "CastOffEncodingDoc");
+
     if (this->IsCastOff()) {
         LogDebug("Document is already cast off");
         return;
@@ -1347,6 +1336,34 @@ void Doc::ConvertToPageBasedDoc()
     this->ResetDataPage();
 }
 
+void Doc::CopyToScoreBasedDoc(Doc *targetDoc)
+{
+    assert(targetDoc);
+    assert(targetDoc->GetChildCount() == 0);
+
+    // If the document is mensural, we have to undo the mensural (segments) cast off
+    this->ConvertToCastOffMensuralDoc(false);
+
+    ConvertToScoreBasedFunctor convertToScoreBased(targetDoc);
+    this->Process(convertToScoreBased);
+
+    // Redo the mensural segment cast of if necessary
+    this->ConvertToCastOffMensuralDoc(true);
+
+    targetDoc->m_notationType = m_notationType;
+    targetDoc->m_isMensuralMusicOnly = m_isMensuralMusicOnly;
+    targetDoc->m_isNeumeLines = m_isNeumeLines;
+    targetDoc->m_header.reset(m_header);
+    targetDoc->m_musicDecls = m_musicDecls;
+
+    targetDoc->m_pageWidth = m_pageWidth;
+    targetDoc->m_pageHeight = m_pageHeight;
+    targetDoc->m_pageMarginBottom = m_pageMarginBottom;
+    targetDoc->m_pageMarginLeft = m_pageMarginLeft;
+    targetDoc->m_pageMarginRight = m_pageMarginRight;
+    targetDoc->m_pageMarginTop = m_pageMarginTop;
+}
+
 void Doc::ConvertToCastOffMensuralDoc(bool castOff)
 {
     if (!this->IsMensuralMusicOnly()) return;
@@ -1785,6 +1802,33 @@ void Doc::RefreshLayout()
     }
 }
 
+void Doc::IndexID(Object *object)
+{
+    assert(object);
+
+    m_idIndex.insert({ object->GetID(), object });
+}
+
+void Doc::UnindexID(Object *object)
+{
+    assert(object);
+
+    auto range = m_idIndex.equal_range(object->GetID());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == object) {
+            m_idIndex.erase(it);
+            return;
+        }
+    }
+}
+
+const Object *Doc::GetIndexedObject(const std::string &id, int &count) const
+{
+    auto range = m_idIndex.equal_range(id);
+    count = (int)std::distance(range.first, range.second);
+    return (count > 0) ? range.first->second : NULL;
+}
+
 void Doc::SetFocus()
 {
     // Focus has already been set
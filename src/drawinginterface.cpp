@@ -45,11 +45,12 @@ DrawingListInterface::~DrawingListInterface() {}
 void DrawingListInterface::Reset()
 {
     m_drawingList.clear();
+    m_drawingListObjects.clear();
 }
 
 void DrawingListInterface::AddToDrawingList(Object *object)
 {
-    if (std::find(m_drawingList.begin(), m_drawingList.end(), object) == m_drawingList.end()) {
+    if (m_drawingListObjects.insert(object).second) {
         // someName not in name, add it
         m_drawingList.push_back(object);
     }
@@ -69,6 +70,7 @@ ArrayOfObjects *DrawingListInterface::GetDrawingList()
 void DrawingListInterface::ResetDrawingList()
 {
     m_drawingList.clear();
+    m_drawingListObjects.clear();
 }
 
 //----------------------------------------------------------------------------
@@ -55,6 +55,7 @@ namespace vrv {
 EditorToolkitCMN::EditorToolkitCMN(Doc *doc, View *view) : EditorToolkit(doc, view)
 {
     m_undoPrepared = false;
+    m_undoReloaded = false;
     m_scoreContext = NULL;
     m_sectionContext = NULL;
     m_currentContext = NULL;
@@ -64,6 +65,8 @@ EditorToolkitCMN::~EditorToolkitCMN()
 {
 #ifndef NO_EDIT_SUPPORT
     this->ClearContext();
+    this->ClearUndoStack(m_undoStack);
+    this->ClearUndoStack(m_redoStack);
 #endif
 }
 
@@ -117,6 +120,8 @@ bool EditorToolkitCMN::ParseEditorAction(const std::string &json_editorAction, b
         }
         m_doc->PrepareData();
         m_doc->ScoreDefSetCurrentDoc(true);
+        // Deltas were applied to the document in place and it needs to be laid out again
+        if (!m_undoReloaded) m_doc->RefreshLayout();
         m_undoPrepared = false;
         m_editInfo.reset();
         m_editInfo.import("chainedId", m_chainedId);
@@ -303,26 +308,142 @@ bool EditorToolkitCMN::ParseSetAction(
 
 void EditorToolkitCMN::PrepareUndo()
 {
-    // We already have a prepared undo - nothing to prepare
+    // We already have a prepared undo - the deltas are added to the current step
     if (m_undoPrepared) return;
 
-    std::string state = this->GetCurrentState();
-    m_undoStack.push_back(state);
-    m_undoMemoryUsage += state.size();
+    m_undoStack.push_back(new EditorUndoStep());
     // When new edit happens, redo stack is cleared
-    while (!m_redoStack.empty()) {
-        m_undoMemoryUsage -= m_redoStack.back().size();
-        m_redoStack.pop_back();
-    }
-    TrimUndoMemory();
+    this->ClearUndoStack(m_redoStack);
     // Set the flag
     m_undoPrepared = true;
 }
 
+void EditorToolkitCMN::AddUndoForAttributes(const Object *element)
+{
+    assert(element);
+
+    Object *attributes = EditorUndoDelta::CreateAttributeHolder(element);
+    // Some attributes cannot be restored from a copy - fallback to a full snapshot
+    if (!attributes) {
+        this->AddUndoForSnapshot();
+        return;
+    }
+
+    EditorUndoDelta delta(UNDO_ATTRIBUTES);
+    delta.m_id = element->GetID();
+    delta.m_object = attributes;
+    this->AddUndoDelta(delta);
+}
+
+void EditorToolkitCMN::AddUndoForInsertion(const Object *element)
+{
+    assert(element);
+
+    EditorUndoDelta delta(UNDO_INSERTION);
+    delta.m_id = element->GetID();
+    this->AddUndoDelta(delta);
+}
+
+void EditorToolkitCMN::AddUndoForDetachment(const Object *parent, Object *element, int idx)
+{
+    assert(parent);
+    assert(element && !element->GetParent());
+
+    EditorUndoDelta delta(UNDO_DETACHMENT);
+    delta.m_id = parent->GetID();
+    delta.m_idx = idx;
+    delta.m_object = element;
+    this->AddUndoDelta(delta);
+}
+
+void EditorToolkitCMN::AddUndoForSnapshot()
+{
+    EditorUndoDelta delta(UNDO_SNAPSHOT);
+    delta.m_state = this->GetCurrentState();
+    this->AddUndoDelta(delta);
+}
+
+void EditorToolkitCMN::AddUndoDelta(const EditorUndoDelta &delta)
+{
+    // This should not happen because PrepareUndo is called before each action
+    if (!m_undoPrepared || m_undoStack.empty()) {
+        if (delta.m_object) delete delta.m_object;
+        return;
+    }
+
+    m_undoStack.back()->AddDelta(delta);
+    m_undoMemoryUsage += delta.GetMemoryUsage();
+    this->TrimUndoMemory();
+}
+
+bool EditorToolkitCMN::RevertUndoStep(EditorUndoStep *step, EditorUndoStep *inverseStep)
+{
+    assert(step);
+    assert(inverseStep);
+
+    // Revert the deltas in reverse order - the inverse step is filled so it can be reverted in the same way
+    for (auto it = step->m_deltas.rbegin(); it != step->m_deltas.rend(); ++it) {
+        EditorUndoDelta &delta = *it;
+        if (delta.m_type == UNDO_SNAPSHOT) {
+            EditorUndoDelta inverse(UNDO_SNAPSHOT);
+            inverse.m_state = this->GetCurrentState();
+            inverseStep->AddDelta(inverse);
+            m_undoReloaded = true;
+            if (!this->ReloadState(delta.m_state)) return false;
+            continue;
+        }
+
+        Object *object = m_doc->FindDescendantByID(delta.m_id);
+        if (!object) {
+            LogError("Element '%s' could not be found for undoing the action", delta.m_id.c_str());
+            return false;
+        }
+
+        if (delta.m_type == UNDO_ATTRIBUTES) {
+            EditorUndoDelta inverse(UNDO_ATTRIBUTES);
+            inverse.m_id = delta.m_id;
+            inverse.m_object = EditorUndoDelta::CreateAttributeHolder(object);
+            if (!inverse.m_object) return false;
+            inverseStep->AddDelta(inverse);
+            EditorUndoDelta::CopyAllAttributes(delta.m_object, object);
+        }
+        else if (delta.m_type == UNDO_INSERTION) {
+            Object *parent = object->GetParent();
+            assert(parent);
+            EditorUndoDelta inverse(UNDO_DETACHMENT);
+            inverse.m_id = parent->GetID();
+            inverse.m_idx = object->GetIdx();
+            inverse.m_object = parent->DetachChild(inverse.m_idx);
+            inverseStep->AddDelta(inverse);
+            parent->Modify();
+        }
+        else if (delta.m_type == UNDO_DETACHMENT) {
+            EditorUndoDelta inverse(UNDO_INSERTION);
+            inverse.m_id = delta.m_object->GetID();
+            inverseStep->AddDelta(inverse);
+            // The object is now owned by the document
+            object->InsertChild(delta.m_object, delta.m_idx);
+            object->Modify();
+            delta.m_object = NULL;
+        }
+    }
+    return true;
+}
+
+void EditorToolkitCMN::ClearUndoStack(std::deque<EditorUndoStep *> &stack)
+{
+    for (EditorUndoStep *step : stack) {
+        m_undoMemoryUsage -= step->m_memoryUsage;
+        delete step;
+    }
+    stack.clear();
+}
+
 std::string EditorToolkitCMN::GetCurrentState()
 {
     MEIOutput meioutput(m_doc);
     meioutput.SetSerializing(true);
+    meioutput.SetBinary(true);
     meioutput.SetBasic(false);
     meioutput.SetScoreBasedMEI(false);
     return meioutput.Export();
@@ -349,38 +470,53 @@ bool EditorToolkitCMN::Undo()
 {
     if (!CanUndo()) return false;
 
-    std::string currentState = this->GetCurrentState();
-    m_redoStack.push_back(currentState);
+    m_undoReloaded = false;
 
-    // Pop the previous state from undo stack
-    std::string previous = m_undoStack.back();
+    // Pop the last step from undo stack and revert it
+    EditorUndoStep *step = m_undoStack.back();
     m_undoStack.pop_back();
+    m_undoMemoryUsage -= step->m_memoryUsage;
+
+    EditorUndoStep *redoStep = new EditorUndoStep();
+    bool success = this->RevertUndoStep(step, redoStep);
+    delete step;
+
+    m_redoStack.push_back(redoStep);
+    m_undoMemoryUsage += redoStep->m_memoryUsage;
 
-    return ReloadState(previous);
+    return success;
 }
 
 bool EditorToolkitCMN::Redo()
 {
     if (!CanRedo()) return false;
 
-    std::string currentState = this->GetCurrentState();
-    m_undoStack.push_back(currentState);
+    m_undoReloaded = false;
 
-    // Pop redo state and load it
-    std::string redoState = m_redoStack.back();
+    // Pop the last step from redo stack and revert it
+    EditorUndoStep *step = m_redoStack.back();
     m_redoStack.pop_back();
+    m_undoMemoryUsage -= step->m_memoryUsage;
+
+    EditorUndoStep *undoStep = new EditorUndoStep();
+    bool success = this->RevertUndoStep(step, undoStep);
+    delete step;
+
+    m_undoStack.push_back(undoStep);
+    m_undoMemoryUsage += undoStep->m_memoryUsage;
 
-    return ReloadState(redoState);
+    return success;
 }
 
 void EditorToolkitCMN::TrimUndoMemory()
 {
-    // Drop the oldest undo entries if we exceed the limit
-    while ((m_undoMemoryUsage > UNDO_MEMORY_LIMIT) && !m_undoStack.empty()) {
-        m_undoMemoryUsage -= m_undoStack.front().size();
+    // Drop the oldest undo entries if we exceed the limit - the current step is always kept
+    while ((m_undoMemoryUsage > UNDO_MEMORY_LIMIT) && (m_undoStack.size() > 1)) {
+        m_undoMemoryUsage -= m_undoStack.front()->m_memoryUsage;
+        delete m_undoStack.front();
         m_undoStack.pop_front();
     }
-    LogInfo("Undo stack size: %dMB", m_undoMemoryUsage / 1024 / 1024);
+    LogDebug("Undo stack size: %dKB", (int)(m_undoMemoryUsage / 1024));
 }
 
 bool EditorToolkitCMN::Chain(jsonxx::Array actions)
@@ -415,6 +551,7 @@ bool EditorToolkitCMN::Drag(std::string &elementId, int x, int y)
         int oct;
         data_PITCHNAME pname
             = (data_PITCHNAME)m_view->CalculatePitchCode(layer, m_view->ToLogicalY(y), element->GetDrawingX(), &oct);
+        this->AddUndoForAttributes(element);
         element->GetPitchInterface()->SetPname(pname);
         element->GetPitchInterface()->SetOct(oct);
 
@@ -438,6 +575,7 @@ bool EditorToolkitCMN::KeyDown(std::string &elementId, int key, bool shiftKey, b
             case KEY_DOWN: step = -1; break;
             default: step = 0;
         }
+        this->AddUndoForAttributes(element);
         interface->AdjustPitchByOffset(step);
         return true;
     }
@@ -487,6 +625,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     TimeSpanningInterface *interface = element->GetTimeSpanningInterface();
     assert(interface);
     measure->AddChild(element);
+    this->AddUndoForInsertion(element);
     interface->SetStartid("#" + startid);
     interface->SetEndid("#" + endid);
 
@@ -533,6 +672,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     TimeSpanningInterface *interface = element->GetTimeSpanningInterface();
     assert(interface);
     measure->AddChild(element);
+    this->AddUndoForInsertion(element);
     interface->SetStartid("#" + startid);
 
     m_chainedId = element->GetID();
@@ -545,6 +685,8 @@ bool EditorToolkitCMN::Set(std::string &elementId, std::string const &attribute,
     Object *element = this->GetChainedElement(elementId);
     if (!element) return false;
 
+    this->AddUndoForAttributes(element);
+
     bool success = false;
     if (element->Is(TEXT) && (attribute == "text")) {
         Text *text = vrv_cast<Text *>(element);
@@ -648,6 +790,7 @@ bool EditorToolkitCMN::InsertNote(Object *object)
         assert(currentChord);
         Note *note = new Note();
         currentChord->AddChild(note);
+        this->AddUndoForInsertion(note);
         m_chainedId = note->GetID();
         return true;
     }
@@ -659,6 +802,7 @@ bool EditorToolkitCMN::InsertNote(Object *object)
         if (currentChord) {
             Note *note = new Note();
             currentChord->AddChild(note);
+            this->AddUndoForInsertion(note);
             m_chainedId = note->GetID();
             return true;
         }
@@ -676,6 +820,8 @@ bool EditorToolkitCMN::InsertNote(Object *object)
             LogInfo("Inserting a note where a note has lyric content is not possible");
             return false;
         }
+        // The note is moved to a new chord - this cannot be undone with a delta
+        this->AddUndoForSnapshot();
         Chord *chord = new Chord();
         chord->DurationInterface::operator=(*currentNote);
         chord->AttCue::operator=(*currentNote);
@@ -711,8 +857,11 @@ bool EditorToolkitCMN::InsertNote(Object *object)
         note->DurationInterface::operator=(*rest);
         Object *parent = rest->GetParent();
         assert(parent);
+        const int idx = rest->GetIdx();
         parent->ReplaceChild(rest, note);
-        delete rest;
+        // The rest is kept by the undo step
+        this->AddUndoForDetachment(parent, rest, idx);
+        this->AddUndoForInsertion(note);
         m_chainedId = note->GetID();
         return true;
     }
@@ -733,6 +882,8 @@ bool EditorToolkitCMN::DeleteNote(Note *note)
         }
         int count = chord->GetChildCount(NOTE, UNLIMITED_DEPTH);
         if (count == 2) {
+            // The chord is replaced by the other note - this cannot be undone with a delta
+            this->AddUndoForSnapshot();
             Note *otherNote = chord->GetTopNote();
             if (note == otherNote) {
                 otherNote = chord->GetBottomNote();
@@ -757,12 +908,17 @@ bool EditorToolkitCMN::DeleteNote(Note *note)
             return true;
         }
         else if (count > 2) {
-            chord->DeleteChild(note);
+            // The note is kept by the undo step
+            const int idx = note->GetIdx();
+            chord->DetachChild(idx);
+            chord->Modify();
+            this->AddUndoForDetachment(chord, note, idx);
             m_chainedId = chord->GetID();
             return true;
         }
         // Handle cases of chords with one single note
         else {
+            this->AddUndoForSnapshot();
             Rest *rest = new Rest();
             rest->DurationInterface::operator=(*chord);
             Object *parent = chord->GetParent();
@@ -773,6 +929,8 @@ bool EditorToolkitCMN::DeleteNote(Note *note)
         }
     }
     else if (beam) {
+        // Beams are restructured - this cannot be undone with a delta
+        this->AddUndoForSnapshot();
         // If the beam has exactly 2 notes (take apart and leave a single note and a
         // rest)
         if ((int)beam->m_beamSegment.GetElementCoordRefs()->size() == 2) {
@@ -841,8 +999,11 @@ bool EditorToolkitCMN::DeleteNote(Note *note)
         rest->DurationInterface::operator=(*note);
         Object *parent = note->GetParent();
         assert(parent);
+        const int idx = note->GetIdx();
         parent->ReplaceChild(note, rest);
-        delete note;
+        // The note is kept by the undo step
+        this->AddUndoForDetachment(parent, note, idx);
+        this->AddUndoForInsertion(rest);
         m_chainedId = rest->GetID();
         return true;
     }
@@ -1186,6 +1347,75 @@ ArrayOfConstObjects EditorTreeObject::GetChildObjects() const
     return childObjects;
 }
 
+//----------------------------------------------------------------------------
+// EditorUndoDelta
+//----------------------------------------------------------------------------
+
+size_t EditorUndoDelta::GetMemoryUsage() const
+{
+    // The size of the objects is only roughly estimated
+    return sizeof(EditorUndoDelta) + m_id.size() + m_state.size() + ((m_object) ? sizeof(*m_object) : 0);
+}
+
+Object *EditorUndoDelta::CreateAttributeHolder(const Object *element)
+{
+    assert(element);
+
+    // Text elements are not created by the factory but their content has to be kept
+    Object *holder = (element->Is(TEXT)) ? element->Clone() : ObjectFactory::GetInstance()->Create(element->GetClassId());
+    if (!holder) return NULL;
+
+    if (holder->GetClassId() == element->GetClassId()) {
+        CopyAllAttributes(element, holder);
+        // Make sure the copy holds exactly the same attributes
+        ArrayOfStrAttr attributes;
+        ArrayOfStrAttr holderAttributes;
+        element->GetAttributes(&attributes);
+        holder->GetAttributes(&holderAttributes);
+        if (attributes == holderAttributes) return holder;
+    }
+
+    delete holder;
+    return NULL;
+}
+
+void EditorUndoDelta::CopyAllAttributes(const Object *element, Object *target)
+{
+    assert(element && target);
+    assert(element->GetClassId() == target->GetClassId());
+
+    // Unlike Object::CopyAttributesTo, all the modules need to be copied since any attribute can be set
+    element->CopyAttributesTo(target);
+    AttModule::CopyEdittrans(element, target);
+    AttModule::CopyFigtable(element, target);
+    AttModule::CopyFingering(element, target);
+    AttModule::CopyHarmony(element, target);
+    AttModule::CopyHeader(element, target);
+    AttModule::CopyPerformance(element, target);
+    AttModule::CopyUsersymbols(element, target);
+
+    if (element->Is(TEXT)) {
+        vrv_cast<Text *>(target)->SetText(vrv_cast<const Text *>(element)->GetText());
+    }
+}
+
+//----------------------------------------------------------------------------
+// EditorUndoStep
+//----------------------------------------------------------------------------
+
+EditorUndoStep::~EditorUndoStep()
+{
+    for (EditorUndoDelta &delta : m_deltas) {
+        if (delta.m_object) delete delta.m_object;
+    }
+}
+
+void EditorUndoStep::AddDelta(const EditorUndoDelta &delta)
+{
+    m_deltas.push_back(delta);
+    m_memoryUsage += delta.GetMemoryUsage();
+}
+
 #endif /* NO_EDIT_SUPPORT */
 
 } // namespace vrv
@@ -62,19 +62,12 @@ bool ZipFileReader::Load(const std::string &filename)
         return false;
     }
 
-    fin.seekg(0, std::ios::end);
-    std::streamsize fileSize = (std::streamsize)fin.tellg();
-    fin.clear();
-    fin.seekg(0, std::wios::beg);
+    this->Reset();
 
-    std::vector<unsigned char> bytes;
-    bytes.reserve(fileSize + 1);
+    // Read the stream directly into the archive buffer, without an intermediate copy
+    m_file = new miniz_cpp::zip_file(fin);
 
-    unsigned char buffer;
-    while (fin.read((char *)&buffer, sizeof(unsigned char))) {
-        bytes.push_back(buffer);
-    }
-    return this->LoadBytes(bytes);
+    return true;
 #endif
 }
 
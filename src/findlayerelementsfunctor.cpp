@@ -12,6 +12,7 @@
 #include "alignfunctor.h"
 #include "layer.h"
 #include "layerelement.h"
+#include "measure.h"
 #include "staff.h"
 
 namespace vrv {
@@ -146,6 +147,47 @@ FunctorCode LayerElementsInTimeSpanFunctor::VisitLayerElement(const LayerElement
     return layerElement->Is(CHORD) ? FUNCTOR_SIBLINGS : FUNCTOR_CONTINUE;
 }
 
+//----------------------------------------------------------------------------
+// LayerElementIndex
+//----------------------------------------------------------------------------
+
+void LayerElementIndex::AddElement(const LayerElement *element, int staffN, int crossStaffN)
+{
+    assert(!m_measures.empty());
+
+    m_measures.back().second.push_back({ element, staffN, crossStaffN });
+}
+
+//----------------------------------------------------------------------------
+// CollectLayerElementIndexFunctor
+//----------------------------------------------------------------------------
+
+CollectLayerElementIndexFunctor::CollectLayerElementIndexFunctor(LayerElementIndex *index) : ConstFunctor()
+{
+    m_index = index;
+}
+
+FunctorCode CollectLayerElementIndexFunctor::VisitLayerElement(const LayerElement *layerElement)
+{
+    if (layerElement->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
+
+    const Staff *staff = layerElement->GetAncestorStaff(ANCESTOR_ONLY, false);
+    if (!staff) return FUNCTOR_CONTINUE;
+
+    const Layer *layer = NULL;
+    const Staff *crossStaff = layerElement->GetCrossStaff(layer);
+    m_index->AddElement(layerElement, staff->GetN(), crossStaff ? crossStaff->GetN() : 0);
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode CollectLayerElementIndexFunctor::VisitMeasure(const Measure *measure)
+{
+    m_index->AddMeasure(measure);
+
+    return FUNCTOR_CONTINUE;
+}
+
 //----------------------------------------------------------------------------
 // FindSpannedLayerElementsFunctor
 //----------------------------------------------------------------------------
@@ -172,76 +214,128 @@ void FindSpannedLayerElementsFunctor::SetMinMaxLayerN(int minLayerN, int maxLaye
     m_maxLayerN = maxLayerN;
 }
 
-FunctorCode FindSpannedLayerElementsFunctor::VisitLayerElement(const LayerElement *layerElement)
+bool FindSpannedLayerElementsFunctor::ProcessIndex(const LayerElementIndex &index, const Object *container)
 {
-    if (layerElement->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
-
-    if (!layerElement->Is(m_classIds)) {
-        return FUNCTOR_CONTINUE;
+    const std::vector<LayerElementIndex::MeasureEntries> &measures = index.GetMeasures();
+
+    // For a measure container only its own elements are searched
+    if (container->Is(MEASURE)) {
+        auto iter = std::find_if(measures.cbegin(), measures.cend(),
+            [container](const LayerElementIndex::MeasureEntries &entries) { return (entries.first == container); });
+        if (iter == measures.cend()) return false;
+        if (!this->IsInMeasureRange(iter->first)) return true;
+        for (const LayerElementIndex::Entry &entry : iter->second) {
+            if (!entry.m_element->Is(m_classIds)) continue;
+            if (!this->IsInStaffNs(entry.m_staffN, entry.m_crossStaffN)) continue;
+            if (this->IsSpanned(entry.m_element)) m_elements.push_back(entry.m_element);
+        }
+        return true;
     }
 
-    if (layerElement->HasContentBB() && !layerElement->HasEmptyBB() && (layerElement->GetContentRight() > m_minPos)
-        && (layerElement->GetContentLeft() < m_maxPos)) {
+    // Otherwise the container must be the system of the index
+    if (measures.empty() || (measures.front().first->GetParent() != container)) return false;
 
-        // We skip the start or end of the slur
-        const LayerElement *start = m_interface->GetStart();
-        const LayerElement *end = m_interface->GetEnd();
-        if ((layerElement == start) || (layerElement == end)) {
-            return FUNCTOR_CONTINUE;
+    for (const LayerElementIndex::MeasureEntries &entries : measures) {
+        if (!this->IsInMeasureRange(entries.first)) continue;
+        for (const LayerElementIndex::Entry &entry : entries.second) {
+            if (!entry.m_element->Is(m_classIds)) continue;
+            if (!this->IsInStaffNs(entry.m_staffN, entry.m_crossStaffN)) continue;
+            if (this->IsSpanned(entry.m_element)) m_elements.push_back(entry.m_element);
         }
+    }
+    return true;
+}
 
-        // Skip if neither parent staff nor cross staff matches the given staff number
-        if (!m_staffNs.empty()) {
-            const Staff *staff = layerElement->GetAncestorStaff();
-            if (m_staffNs.find(staff->GetN()) == m_staffNs.end()) {
-                const Layer *layer = NULL;
-                staff = layerElement->GetCrossStaff(layer);
-                if (!staff || (m_staffNs.find(staff->GetN()) == m_staffNs.end())) {
-                    return FUNCTOR_CONTINUE;
-                }
-            }
-        }
+bool FindSpannedLayerElementsFunctor::IsInStaffNs(int staffN, int crossStaffN) const
+{
+    if (m_staffNs.empty()) return true;
+    if (m_staffNs.find(staffN) != m_staffNs.end()) return true;
+    return (crossStaffN && (m_staffNs.find(crossStaffN) != m_staffNs.end()));
+}
 
-        // Skip if layer number is outside given bounds
-        const int layerN = layerElement->GetOriginalLayerN();
-        if (m_minLayerN && (m_minLayerN > layerN)) {
-            return FUNCTOR_CONTINUE;
-        }
-        if (m_maxLayerN && (m_maxLayerN < layerN)) {
-            return FUNCTOR_CONTINUE;
-        }
+bool FindSpannedLayerElementsFunctor::IsSpanned(const LayerElement *layerElement) const
+{
+    if (!layerElement->HasContentBB() || layerElement->HasEmptyBB() || (layerElement->GetContentRight() <= m_minPos)
+        || (layerElement->GetContentLeft() >= m_maxPos)) {
+        return false;
+    }
+
+    // We skip the start or end of the slur
+    const LayerElement *start = m_interface->GetStart();
+    const LayerElement *end = m_interface->GetEnd();
+    if ((layerElement == start) || (layerElement == end)) {
+        return false;
+    }
+
+    // Skip if layer number is outside given bounds
+    const int layerN = layerElement->GetOriginalLayerN();
+    if (m_minLayerN && (m_minLayerN > layerN)) {
+        return false;
+    }
+    if (m_maxLayerN && (m_maxLayerN < layerN)) {
+        return false;
+    }
 
-        // Skip elements aligned at start/end, but on a different staff
-        if ((layerElement->GetAlignment() == start->GetAlignment()) && !start->Is(TIMESTAMP_ATTR)) {
-            const Staff *staff = layerElement->GetAncestorStaff(RESOLVE_CROSS_STAFF);
-            const Staff *startStaff = start->GetAncestorStaff(RESOLVE_CROSS_STAFF);
-            if (staff->GetN() != startStaff->GetN()) {
-                return FUNCTOR_CONTINUE;
-            }
+    // Skip elements aligned at start/end, but on a different staff
+    if ((layerElement->GetAlignment() == start->GetAlignment()) && !start->Is(TIMESTAMP_ATTR)) {
+        const Staff *staff = layerElement->GetAncestorStaff(RESOLVE_CROSS_STAFF);
+        const Staff *startStaff = start->GetAncestorStaff(RESOLVE_CROSS_STAFF);
+        if (staff->GetN() != startStaff->GetN()) {
+            return false;
         }
-        if ((layerElement->GetAlignment() == end->GetAlignment()) && !end->Is(TIMESTAMP_ATTR)) {
-            const Staff *staff = layerElement->GetAncestorStaff(RESOLVE_CROSS_STAFF);
-            const Staff *endStaff = end->GetAncestorStaff(RESOLVE_CROSS_STAFF);
-            if (staff->GetN() != endStaff->GetN()) {
-                return FUNCTOR_CONTINUE;
-            }
+    }
+    if ((layerElement->GetAlignment() == end->GetAlignment()) && !end->Is(TIMESTAMP_ATTR)) {
+        const Staff *staff = layerElement->GetAncestorStaff(RESOLVE_CROSS_STAFF);
+        const Staff *endStaff = end->GetAncestorStaff(RESOLVE_CROSS_STAFF);
+        if (staff->GetN() != endStaff->GetN()) {
+            return false;
         }
-
-        m_elements.push_back(layerElement);
     }
 
-    return FUNCTOR_CONTINUE;
+    return true;
 }
 
-FunctorCode FindSpannedLayerElementsFunctor::VisitMeasure(const Measure *measure)
+bool FindSpannedLayerElementsFunctor::IsInMeasureRange(const Measure *measure) const
+{
+    if (Object::IsPreOrdered(measure, m_interface->GetStartMeasure())) return false;
+
+    if (Object::IsPreOrdered(m_interface->GetEndMeasure(), measure)) return false;
+
+    return true;
+}
+
+FunctorCode FindSpannedLayerElementsFunctor::VisitLayerElement(const LayerElement *layerElement)
 {
-    if (Object::IsPreOrdered(measure, m_interface->GetStartMeasure())) return FUNCTOR_SIBLINGS;
+    if (layerElement->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
+
+    if (!layerElement->Is(m_classIds)) {
+        return FUNCTOR_CONTINUE;
+    }
 
-    if (Object::IsPreOrdered(m_interface->GetEndMeasure(), measure)) return FUNCTOR_SIBLINGS;
+    if (!this->IsSpanned(layerElement)) {
+        return FUNCTOR_CONTINUE;
+    }
+
+    // Skip if neither parent staff nor cross staff matches the given staff number
+    if (!m_staffNs.empty()) {
+        const Staff *staff = layerElement->GetAncestorStaff();
+        const Layer *layer = NULL;
+        const Staff *crossStaff = layerElement->GetCrossStaff(layer);
+        if (!this->IsInStaffNs(staff->GetN(), crossStaff ? crossStaff->GetN() : 0)) {
+            return FUNCTOR_CONTINUE;
+        }
+    }
+
+    m_elements.push_back(layerElement);
 
     return FUNCTOR_CONTINUE;
 }
 
+FunctorCode FindSpannedLayerElementsFunctor::VisitMeasure(const Measure *measure)
+{
+    return this->IsInMeasureRange(measure) ? FUNCTOR_CONTINUE : FUNCTOR_SIBLINGS;
+}
+
 //----------------------------------------------------------------------------
 // GetRelativeLayerElementFunctor
 //----------------------------------------------------------------------------
@@ -29,6 +29,8 @@ namespace vrv {
 // Glyph
 //----------------------------------------------------------------------------
 
+std::mutex Glyph::s_xmlDocumentMutex;
+
 Glyph::Glyph()
 {
     m_x = 0;
@@ -160,4 +162,17 @@ std::string Glyph::GetXML() const
     }
 }
 
+const pugi::xml_document *Glyph::GetXMLDocument() const
+{
+    const std::lock_guard<std::mutex> lock(s_xmlDocumentMutex);
+
+    if (!m_xmlDocument) {
+        std::shared_ptr<pugi::xml_document> xmlDocument = std::make_shared<pugi::xml_document>();
+        // An empty document is kept if the XML cannot be parsed
+        xmlDocument->load_string(this->GetXML().c_str());
+        m_xmlDocument = xmlDocument;
+    }
+    return m_xmlDocument.get();
+}
+
 } // namespace vrv
@@ -870,16 +870,8 @@ bool AlignmentReference::HasAccidVerticalOverlap(const ArrayOfConstObjects &obje
 
 bool AlignmentReference::HasCrossStaffElements() const
 {
-    ListOfConstObjects children;
-    ClassIdsComparison classId({ NOTE, CHORD });
-    this->FindAllDescendantsByComparison(&children, &classId);
-
-    for (const auto child : children) {
-        const LayerElement *layerElement = vrv_cast<const LayerElement *>(child);
-        if (layerElement->m_crossStaff) return true;
-    }
-
-    return false;
+    CrossStaffComparison crossStaff;
+    return (this->FindDescendantByComparison(&crossStaff) != NULL);
 }
 
 FunctorCode AlignmentReference::Accept(Functor &functor)
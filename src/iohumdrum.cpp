@@ -691,6 +691,30 @@ string HumdrumInput::GetHumdrumString()
     return tempout.str();
 }
 
+//////////////////////////////
+//
+// HumdrumInput::ApplyFilters -- Run the tools given in !!!filter: and
+//     !!!!filter: reference records.  The filter tool updates each file
+//     in place (re-reading a file only when one of the tools in its
+//     pipeline rewrites it), so there is no need to serialize the files
+//     and parse them back afterwards.
+//
+
+void HumdrumInput::ApplyFilters(hum::HumdrumFileSet &infiles)
+{
+    for (int i = 0; i < infiles.getCount(); ++i) {
+        if (infiles[i].hasGlobalFilters()) {
+            hum::Tool_filter filter;
+            filter.run(infiles[i]);
+        }
+    }
+
+    if (infiles.hasUniversalFilters()) {
+        hum::Tool_filter filter;
+        filter.runUniversal(infiles);
+    }
+}
+
 //////////////////////////////
 //
 // HumdrumInput::convertHumdrum -- Top level method called from ImportFile or
@@ -714,40 +738,17 @@ bool HumdrumInput::convertHumdrum()
         return false;
     }
 
-    // Apply Humdrum tools if there are any filters in the file.
-    hum::Tool_filter filter;
-    for (int i = 0; i < m_infiles.getCount(); ++i) {
-        if (m_infiles[i].hasGlobalFilters()) {
-            filter.run(m_infiles[i]);
-            if (filter.hasHumdrumText()) {
-                m_infiles[i].readString(filter.getHumdrumText());
-            }
-            else {
-                // should have auto updated itself in the filter.
-            }
-        }
-    }
+    ApplyFilters(m_infiles);
 
-    // Apply Humdrum tools to the entire set if they are
-    // at the universal level.
-    if (m_infiles.hasUniversalFilters()) {
-        filter.runUniversal(m_infiles);
-        if (filter.hasHumdrumText()) {
-            m_infiles.readString(filter.getHumdrumText());
-        }
-    }
-
-    // Kernify files if they have no stafflike spine.
-    hum::Tool_kernify kernify;
+    // Kernify files if they have no stafflike spine.  The kernify tool
+    // inserts a spine so the file has to be read again from its output.
     for (int i = 0; i < m_infiles.getCount(); ++i) {
         if (hasNoStaves(m_infiles[i])) {
+            hum::Tool_kernify kernify;
             kernify.run(m_infiles[i]);
             if (kernify.hasHumdrumText()) {
                 m_infiles[i].readString(kernify.getHumdrumText());
             }
-            else {
-                // should have auto updated itself in the kernify filter.
-            }
         }
     }
 
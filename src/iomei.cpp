@@ -183,6 +183,7 @@ MEIOutput::MEIOutput(Doc *doc) : Output(doc)
     m_scoreBasedMEI = false;
     m_basic = false;
     m_serializing = false;
+    m_binary = false;
     m_ignoreHeader = false;
     m_removeIds = false;
 
@@ -267,6 +268,7 @@ std::string MEIOutput::Export()
             m_currentNode = meiDoc.append_child("verovio-serialization");
             m_nodeStack.push_back(m_currentNode);
             m_doc->GetPages()->SaveObject(this);
+            if (m_binary) return MEIBinaryCodec::Encode(meiDoc);
             meiDoc.save(streamStringOutput);
             return streamStringOutput.str();
         }
@@ -3567,10 +3569,37 @@ MEIInput::MEIInput(Doc *doc) : Input(doc)
 MEIInput::~MEIInput() {}
 
 bool MEIInput::Import(const std::string &mei)
+{
+    pugi::xml_document doc;
+    if (MEIBinaryCodec::IsBinary(mei)) {
+        if (!m_deserializing || !MEIBinaryCodec::Decode(mei, doc)) {
+            LogError("Invalid binary serialization");
+            return false;
+        }
+    }
+    else {
+        doc.load_buffer(mei.data(), mei.size(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol,
+            pugi::encoding_utf8);
+    }
+    return this->ImportDocument(doc);
+}
+
+bool MEIInput::ImportInPlace(std::string &mei)
+{
+    if (MEIBinaryCodec::IsBinary(mei) || mei.empty()) {
+        return this->Import(mei);
+    }
+
+    // The document nodes point into the buffer, which therefore has to outlive it
+    pugi::xml_document doc;
+    doc.load_buffer_inplace(&mei[0], mei.size(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol,
+        pugi::encoding_utf8);
+    return this->ImportDocument(doc);
+}
+
+bool MEIInput::ImportDocument(pugi::xml_document &doc)
 {
     try {
-        pugi::xml_document doc;
-        doc.load_string(mei.c_str(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
         pugi::xml_node root = doc.first_child();
         if (m_deserializing) {
             m_doc->ResetToSerialization();
@@ -8660,8 +8689,10 @@ bool MEIInput::IsEditorialElementName(std::string elementName)
 void MEIInput::NormalizeAttributes(pugi::xml_node &xmlElement)
 {
     for (auto elem : xmlElement.attributes()) {
-        std::string name = elem.name();
-        std::string value = elem.value();
+        // Only rewrite values that actually have leading or trailing spaces
+        std::string_view view = elem.value();
+        if (view.empty() || ((view.front() != ' ') && (view.back() != ' '))) continue;
+        std::string value(view);
 
         size_t pos = value.find_first_not_of(' ');
         if (pos != std::string::npos) value = value.substr(pos);
@@ -9090,4 +9121,153 @@ bool MEIInput::ReadFacsimile(Doc *doc, pugi::xml_node facsimile)
     return true;
 }
 
+
+//----------------------------------------------------------------------------
+// MEIBinaryCodec
+//----------------------------------------------------------------------------
+
+const std::string MEIBinaryCodec::s_header = std::string("VRVB") + char(1);
+
+bool MEIBinaryCodec::IsBinary(const std::string &data)
+{
+    return (data.compare(0, s_header.size(), s_header) == 0);
+}
+
+std::string MEIBinaryCodec::Encode(const pugi::xml_document &doc)
+{
+    // The strings are owned by the document, which is not modified while encoding
+    std::unordered_map<std::string_view, uint32_t> strings;
+    std::vector<std::string_view> stringTable;
+    // The empty string is always the first one
+    Intern("", strings, stringTable);
+
+    // Encode the tree first for filling the string table
+    // The XML declaration is skipped since it is not loaded when parsing XML either
+    std::string tree;
+    std::vector<pugi::xml_node> children;
+    for (pugi::xml_node child : doc.children()) {
+        if (child.type() != pugi::node_declaration) children.push_back(child);
+    }
+    WriteVarint((uint32_t)children.size(), tree);
+    for (pugi::xml_node child : children) {
+        EncodeNode(child, strings, stringTable, tree);
+    }
+
+    std::string output = s_header;
+    WriteVarint((uint32_t)stringTable.size(), output);
+    for (std::string_view str : stringTable) {
+        WriteVarint((uint32_t)str.size(), output);
+        output.append(str);
+    }
+    output.append(tree);
+
+    return output;
+}
+
+bool MEIBinaryCodec::Decode(const std::string &data, pugi::xml_document &doc)
+{
+    if (!IsBinary(data)) return false;
+
+    size_t pos = s_header.size();
+    uint32_t stringCount;
+    if (!ReadVarint(data, pos, stringCount)) return false;
+
+    std::vector<std::string> stringTable;
+    stringTable.reserve(std::min<size_t>(stringCount, data.size()));
+    for (uint32_t i = 0; i < stringCount; ++i) {
+        uint32_t length;
+        if (!ReadVarint(data, pos, length) || (length > data.size() - pos)) return false;
+        stringTable.push_back(data.substr(pos, length));
+        pos += length;
+    }
+
+    uint32_t childCount;
+    if (!ReadVarint(data, pos, childCount)) return false;
+    for (uint32_t i = 0; i < childCount; ++i) {
+        if (!DecodeNode(doc, stringTable, data, pos)) return false;
+    }
+
+    return (pos == data.size());
+}
+
+void MEIBinaryCodec::EncodeNode(pugi::xml_node node, std::unordered_map<std::string_view, uint32_t> &strings,
+    std::vector<std::string_view> &stringTable, std::string &output)
+{
+    WriteVarint((uint32_t)node.type(), output);
+    WriteVarint(Intern(node.name(), strings, stringTable), output);
+    WriteVarint(Intern(node.value(), strings, stringTable), output);
+
+    uint32_t attributeCount = (uint32_t)std::distance(node.attributes_begin(), node.attributes_end());
+    WriteVarint(attributeCount, output);
+    for (pugi::xml_attribute attribute : node.attributes()) {
+        WriteVarint(Intern(attribute.name(), strings, stringTable), output);
+        WriteVarint(Intern(attribute.value(), strings, stringTable), output);
+    }
+
+    uint32_t childCount = (uint32_t)std::distance(node.begin(), node.end());
+    WriteVarint(childCount, output);
+    for (pugi::xml_node child : node.children()) {
+        EncodeNode(child, strings, stringTable, output);
+    }
+}
+
+bool MEIBinaryCodec::DecodeNode(
+    pugi::xml_node parent, const std::vector<std::string> &stringTable, const std::string &data, size_t &pos)
+{
+    uint32_t type, name, value;
+    if (!ReadVarint(data, pos, type) || !ReadVarint(data, pos, name) || !ReadVarint(data, pos, value)) return false;
+    if ((type <= pugi::node_document) || (type > pugi::node_doctype)) return false;
+    if ((name >= stringTable.size()) || (value >= stringTable.size())) return false;
+
+    pugi::xml_node node = parent.append_child((pugi::xml_node_type)type);
+    if (!node) return false;
+    if (!stringTable.at(name).empty()) node.set_name(stringTable.at(name).c_str());
+    if (!stringTable.at(value).empty()) node.set_value(stringTable.at(value).c_str());
+
+    uint32_t attributeCount;
+    if (!ReadVarint(data, pos, attributeCount)) return false;
+    for (uint32_t i = 0; i < attributeCount; ++i) {
+        if (!ReadVarint(data, pos, name) || !ReadVarint(data, pos, value)) return false;
+        if ((name >= stringTable.size()) || (value >= stringTable.size())) return false;
+        node.append_attribute(stringTable.at(name).c_str()) = stringTable.at(value).c_str();
+    }
+
+    uint32_t childCount;
+    if (!ReadVarint(data, pos, childCount)) return false;
+    for (uint32_t i = 0; i < childCount; ++i) {
+        if (!DecodeNode(node, stringTable, data, pos)) return false;
+    }
+
+    return true;
+}
+
+uint32_t MEIBinaryCodec::Intern(const char *str, std::unordered_map<std::string_view, uint32_t> &strings,
+    std::vector<std::string_view> &stringTable)
+{
+    auto [iter, inserted] = strings.try_emplace(str, (uint32_t)stringTable.size());
+    if (inserted) stringTable.push_back(iter->first);
+    return iter->second;
+}
+
+void MEIBinaryCodec::WriteVarint(uint32_t value, std::string &output)
+{
+    while (value >= 0x80) {
+        output.push_back((char)((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    output.push_back((char)value);
+}
+
+bool MEIBinaryCodec::ReadVarint(const std::string &data, size_t &pos, uint32_t &value)
+{
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (pos >= data.size()) return false;
+        const unsigned char byte = (unsigned char)data[pos++];
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
 } // namespace vrv
@@ -126,7 +126,28 @@ bool MusicXmlInput::Import(const std::string &musicxml)
         m_doc->Reset();
         m_doc->SetType(Raw);
         pugi::xml_document xmlDoc;
-        xmlDoc.load_string(musicxml.c_str());
+        xmlDoc.load_buffer(musicxml.data(), musicxml.size(), pugi::parse_default, pugi::encoding_utf8);
+        pugi::xml_node root = xmlDoc.first_child();
+        return ReadMusicXml(root);
+    }
+    catch (char *str) {
+        LogError("%s", str);
+        return false;
+    }
+}
+
+bool MusicXmlInput::ImportInPlace(std::string &musicxml)
+{
+    if (musicxml.empty()) {
+        return this->Import(musicxml);
+    }
+
+    try {
+        m_doc->Reset();
+        m_doc->SetType(Raw);
+        // The document nodes point into the buffer, which therefore has to outlive it
+        pugi::xml_document xmlDoc;
+        xmlDoc.load_buffer_inplace(&musicxml[0], musicxml.size(), pugi::parse_default, pugi::encoding_utf8);
         pugi::xml_node root = xmlDoc.first_child();
         return ReadMusicXml(root);
     }
@@ -154,7 +175,7 @@ bool MusicXmlInput::IsElement(const pugi::xml_node node, const std::string &name
 {
     assert(node);
 
-    if (std::string(node.name()) == name) {
+    if (node.name() == name) {
         return true;
     }
     return false;
@@ -170,6 +191,63 @@ bool MusicXmlInput::HasContentWithValue(const pugi::xml_node node, const std::st
     return false;
 }
 
+pugi::xml_node MusicXmlInput::SelectChildWithoutAttribute(
+    const pugi::xml_node node, const std::string &name, const std::string &attribute) const
+{
+    for (pugi::xml_node child : node.children(name.c_str())) {
+        if (!child.attribute(attribute.c_str())) return child;
+    }
+    return pugi::xml_node();
+}
+
+pugi::xml_node MusicXmlInput::SelectGrandchild(const pugi::xml_node node, const std::string &child,
+    const std::string &grandchild, const std::string &attribute, const std::string &value) const
+{
+    for (pugi::xml_node childNode : node.children(child.c_str())) {
+        for (pugi::xml_node grandchildNode : childNode.children(grandchild.c_str())) {
+            if (attribute.empty() || HasAttributeWithValue(grandchildNode, attribute, value)) return grandchildNode;
+        }
+    }
+    return pugi::xml_node();
+}
+
+pugi::xml_node MusicXmlInput::SelectBeam(
+    const pugi::xml_node node, const std::string &value, const std::string &number) const
+{
+    for (pugi::xml_node beam : node.children("beam")) {
+        if (!number.empty() && !HasAttributeWithValue(beam, "number", number)) continue;
+        if (HasContentWithValue(beam, value)) return beam;
+    }
+    return pugi::xml_node();
+}
+
+pugi::xml_node MusicXmlInput::SelectAncestor(const pugi::xml_node node, const std::string &name) const
+{
+    for (pugi::xml_node parent = node.parent(); parent; parent = parent.parent()) {
+        if (IsElement(parent, name)) return parent;
+    }
+    return pugi::xml_node();
+}
+
+pugi::xml_node MusicXmlInput::SelectFollowing(const pugi::xml_node node, const std::string &name,
+    const std::function<bool(const pugi::xml_node)> &predicate) const
+{
+    // start after the subtree of the node and walk the rest of the document in document order
+    pugi::xml_node current = node;
+    while (current && !current.next_sibling()) current = current.parent();
+    if (current) current = current.next_sibling();
+    while (current) {
+        if ((current.type() == pugi::node_element) && IsElement(current, name) && predicate(current)) return current;
+        if (current.first_child()) {
+            current = current.first_child();
+            continue;
+        }
+        while (current && !current.next_sibling()) current = current.parent();
+        if (current) current = current.next_sibling();
+    }
+    return pugi::xml_node();
+}
+
 std::string MusicXmlInput::GetContent(const pugi::xml_node node) const
 {
     assert(node);
@@ -180,9 +258,9 @@ std::string MusicXmlInput::GetContent(const pugi::xml_node node) const
     return "";
 }
 
-std::string MusicXmlInput::GetContentOfChild(const pugi::xml_node node, const std::string &child) const
+std::string MusicXmlInput::GetContentOfChild(const pugi::xml_node node, const pugi::xpath_query &query) const
 {
-    pugi::xpath_node childNode = node.select_node(child.c_str());
+    pugi::xpath_node childNode = node.select_node(query);
     if (childNode.node()) {
         return GetContent(childNode.node());
     }
@@ -194,8 +272,8 @@ void MusicXmlInput::ProcessClefChangeQueue(Section *section)
     while (!m_clefChangeQueue.empty()) {
         musicxml::ClefChange clefChange = m_clefChangeQueue.front();
         m_clefChangeQueue.pop_front();
-        AttNNumberLikeComparison comparisonMeasure(MEASURE, clefChange.m_measureNum);
-        Measure *currentMeasure = vrv_cast<Measure *>(section->FindDescendantByComparison(&comparisonMeasure));
+        const std::vector<Measure *> &matchingMeasures = this->GetMeasuresByN(clefChange.m_measureNum);
+        Measure *currentMeasure = (matchingMeasures.empty()) ? NULL : matchingMeasures.front();
         if (!currentMeasure) {
             LogWarning("MusicXML import: Clef change at measure %s, staff %d, time %d not inserted",
                 clefChange.m_measureNum.c_str(), clefChange.m_staff->GetN(), clefChange.m_scoreOnset);
@@ -212,7 +290,7 @@ void MusicXmlInput::ProcessClefChangeQueue(Section *section)
                 continue;
             }
             AttNIntegerComparison comparisonStaff(STAFF, clefChange.m_staff->GetN());
-            Staff *previousStaff = vrv_cast<Staff *>(previousMeasure->FindDescendantByComparison(&comparisonStaff));
+            Staff *previousStaff = vrv_cast<Staff *>(previousMeasure->FindDescendantByComparison(&comparisonStaff, 1));
             if (previousStaff == NULL) {
                 this->AddClefs(currentMeasure, clefChange);
                 continue;
@@ -358,22 +436,20 @@ void MusicXmlInput::AddMeasure(Section *section, Measure *measure, int i)
     // we just need to add a measure
     if (section->GetChildCount(MEASURE) <= i - GetMrestMeasuresCountBeforeIndex(i)) {
         section->AddChild(measure);
+        m_measuresByN[measure->GetN()].push_back(measure);
         contentMeasure = measure;
     }
     // otherwise copy the content to the corresponding existing measure
     else {
         Measure *existingMeasure = NULL;
         // Search by measure number first
-        ListOfObjects matchingMeasures;
-        AttNNumberLikeComparison comparisonMeasure(MEASURE, measure->GetN());
-        section->FindAllDescendantsByComparison(&matchingMeasures, &comparisonMeasure, 1);
+        const std::vector<Measure *> &matchingMeasures = this->GetMeasuresByN(measure->GetN());
         // For now take the first match
         if (!matchingMeasures.empty()) {
-            existingMeasure = vrv_cast<Measure *>(matchingMeasures.front());
+            existingMeasure = matchingMeasures.front();
         }
         // Prefer any measure with matching index (measure numbers might be non-unique)
-        for (Object *object : matchingMeasures) {
-            Measure *matchingMeasure = vrv_cast<Measure *>(object);
+        for (Measure *matchingMeasure : matchingMeasures) {
             if (m_measureCounts.at(matchingMeasure) == i) {
                 existingMeasure = matchingMeasure;
                 break;
@@ -998,13 +1074,16 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
                 if (!groupBarline.empty()) staffGrp->SetBarThru((groupBarline == "no") ? BOOLEAN_false : BOOLEAN_true);
                 if (groupBarline == "Mensurstrich") staffGrp->SetBarMethod(BARMETHOD_mensur);
                 // now stack it
-                const std::string groupName
-                    = GetContentOfChild(xpathNode.node(), "group-name[not(@print-object='no')]");
-                const std::string groupAbbr
-                    = GetContentOfChild(xpathNode.node(), "group-abbreviation[not(@print-object='no')]");
+                static const pugi::xpath_query groupNameQuery("group-name[not(@print-object='no')]");
+                static const pugi::xpath_query groupAbbrQuery("group-abbreviation[not(@print-object='no')]");
+                static const pugi::xpath_query groupNameDisplayQuery("group-name-display[not(@print-object='no')]");
+                static const pugi::xpath_query groupAbbrDisplayQuery(
+                    "group-abbreviation-display[not(@print-object='no')]");
+                const std::string groupName = GetContentOfChild(xpathNode.node(), groupNameQuery);
+                const std::string groupAbbr = GetContentOfChild(xpathNode.node(), groupAbbrQuery);
                 if (!groupName.empty() && !m_label) {
                     m_label = new Label();
-                    if (xpathNode.node().select_node("group-name-display[not(@print-object='no')]")) {
+                    if (xpathNode.node().select_node(groupNameDisplayQuery)) {
                         const std::string name = StyleLabel(xpathNode.node().child("group-name-display"));
                         Text *text = new Text();
                         text->SetText(UTF8to32(name));
@@ -1020,7 +1099,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
                 }
                 if (!groupAbbr.empty() && !m_labelAbbr) {
                     m_labelAbbr = new LabelAbbr();
-                    if (xpathNode.node().select_node("group-abbreviation-display[not(@print-object='no')]")) {
+                    if (xpathNode.node().select_node(groupAbbrDisplayQuery)) {
                         const std::string name = StyleLabel(xpathNode.node().child("group-abbreviation-display"));
                         Text *text = new Text();
                         text->SetText(UTF8to32(name));
@@ -1045,22 +1124,26 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
         else if (IsElement(xpathNode.node(), "score-part")) {
             // get the attributes element of the first measure of the part
             const std::string partId = xpathNode.node().attribute("id").as_string();
-            std::string xpath = StringFormat("/score-partwise/part[@id='%s']/measure[1]", partId.c_str());
-            pugi::xpath_node partFirstMeasure = root.select_node(xpath.c_str());
-            if (!partFirstMeasure.node().child("attributes")) {
+            const pugi::xml_node part
+                = root.root().child("score-partwise").find_child_by_attribute("part", "id", partId.c_str());
+            const pugi::xml_node partFirstMeasure = part.child("measure");
+            if (!partFirstMeasure.child("attributes")) {
                 LogWarning("MusicXML import: Could not find the 'attributes' element in the first "
                            "measure of part '%s'",
                     partId.c_str());
                 continue;
             }
             // part-name should be revised, as soon MEI can suppress labels
-            const std::string partName = GetContentOfChild(xpathNode.node(), "part-name[not(@print-object='no')]");
-            const std::string partAbbr
-                = GetContentOfChild(xpathNode.node(), "part-abbreviation[not(@print-object='no')]");
+            static const pugi::xpath_query partNameQuery("part-name[not(@print-object='no')]");
+            static const pugi::xpath_query partAbbrQuery("part-abbreviation[not(@print-object='no')]");
+            static const pugi::xpath_query partNameDisplayQuery("part-name-display[not(@print-object='no')]");
+            static const pugi::xpath_query partAbbrDisplayQuery("part-abbreviation-display[not(@print-object='no')]");
+            const std::string partName = GetContentOfChild(xpathNode.node(), partNameQuery);
+            const std::string partAbbr = GetContentOfChild(xpathNode.node(), partAbbrQuery);
             pugi::xml_node midiInstrument = xpathNode.node().child("midi-instrument");
             if (!partName.empty() && !m_label) {
                 m_label = new Label();
-                if (xpathNode.node().select_node("part-name-display[not(@print-object='no')]")) {
+                if (xpathNode.node().select_node(partNameDisplayQuery)) {
                     const std::string name = StyleLabel(xpathNode.node().child("part-name-display"));
                     Text *text = new Text();
                     text->SetText(UTF8to32(name));
@@ -1083,7 +1166,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
             }
             if (!partAbbr.empty() && !m_labelAbbr) {
                 m_labelAbbr = new LabelAbbr();
-                if (xpathNode.node().select_node("part-abbreviation-display[not(@print-object='no')]")) {
+                if (xpathNode.node().select_node(partAbbrDisplayQuery)) {
                     const std::string name = StyleLabel(xpathNode.node().child("part-abbreviation-display"));
                     Text *text = new Text();
                     text->SetText(UTF8to32(name));
@@ -1121,7 +1204,7 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
             StaffGrp *partStaffGrp = new StaffGrp();
             partStaffGrp->SetID(partId.c_str());
             const short int nbStaves
-                = ReadMusicXmlPartAttributesAsStaffDef(partFirstMeasure.node(), partStaffGrp, staffOffset);
+                = ReadMusicXmlPartAttributesAsStaffDef(partFirstMeasure, partStaffGrp, staffOffset);
             // if we have more than one staff in the part we create a new staffGrp
             if (nbStaves > 1) {
                 partStaffGrp->SetBarThru(BOOLEAN_true);
@@ -1137,14 +1220,12 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
                 delete partStaffGrp;
             }
 
-            // find the part and read it
-            xpath = StringFormat("/score-partwise/part[@id='%s']", partId.c_str());
-            pugi::xpath_node part = root.select_node(xpath.c_str());
+            // read the part found above
             if (!part) {
                 LogWarning("MusicXML import: Could not find the part '%s'", partId.c_str());
                 continue;
             }
-            this->ReadMusicXmlPart(part.node(), section, nbStaves, staffOffset);
+            this->ReadMusicXmlPart(part, section, nbStaves, staffOffset);
             // increment the staffOffset for reading the next part
             staffOffset += nbStaves;
         }
@@ -1159,8 +1240,8 @@ bool MusicXmlInput::ReadMusicXml(pugi::xml_node root)
     Measure *measure = NULL;
     for (auto iter : m_controlElements) {
         if (!measure || (measure->GetN() != iter.first)) {
-            AttNNumberLikeComparison comparisonMeasure(MEASURE, iter.first);
-            measure = vrv_cast<Measure *>(section->FindDescendantByComparison(&comparisonMeasure, 1));
+            const std::vector<Measure *> &matchingMeasures = this->GetMeasuresByN(iter.first);
+            measure = (matchingMeasures.empty()) ? NULL : matchingMeasures.front();
         }
         if (!measure) {
             LogWarning("MusicXML import: Element '%s' could not be added to measure %s",
@@ -1516,9 +1597,9 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
 
     // First get the number of staves in the part
     short int nbStaves = 1;
-    pugi::xpath_node staves = node.select_node("attributes[1]/staves");
+    pugi::xml_node staves = node.child("attributes").child("staves");
     if (staves) {
-        nbStaves = staves.node().text().as_int();
+        nbStaves = staves.text().as_int();
     }
     if (nbStaves > 1) {
         if (m_label) staffGrp->AddChild(m_label);
@@ -1546,7 +1627,6 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
             continue;
         }
 
-        std::string xpath;
         // Create as many staffDef
         for (int i = 0; i < nbStaves; ++i) {
             // Find or create the staffDef
@@ -1570,14 +1650,14 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
             }
 
             // clef sign - first look if we have a clef-sign with the corresponding staff @number
-            std::string xpath = StringFormat("clef[@number='%d']", i + 1);
-            pugi::xpath_node clef = child.select_node(xpath.c_str());
+            const std::string staffNumber = std::to_string(i + 1);
+            pugi::xml_node clef = child.find_child_by_attribute("clef", "number", staffNumber.c_str());
             // if not, look at a common one
             if (!clef) {
-                clef = child.select_node("clef[not(@number)]");
-                if (nbStaves > 1) clef.node().remove_attribute("id");
+                clef = SelectChildWithoutAttribute(child, "clef", "number");
+                if (nbStaves > 1) clef.remove_attribute("id");
             }
-            Clef *meiClef = ConvertClef(clef.node());
+            Clef *meiClef = ConvertClef(clef);
             if (meiClef) {
                 staffDef->AddChild(meiClef);
                 // if TAB assume guitar tablature until we examine <staff-details>, if any
@@ -1585,49 +1665,46 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
             }
 
             // key sig
-            xpath = StringFormat("key[@number='%d']", i + 1);
-            pugi::xpath_node key = child.select_node(xpath.c_str());
+            pugi::xml_node key = child.find_child_by_attribute("key", "number", staffNumber.c_str());
             if (!key) {
-                key = child.select_node("key[not(@number)]");
-                if (nbStaves > 1) key.node().remove_attribute("id");
+                key = SelectChildWithoutAttribute(child, "key", "number");
+                if (nbStaves > 1) key.remove_attribute("id");
             }
             if (key) {
-                KeySig *meiKey = ConvertKey(key.node());
+                KeySig *meiKey = ConvertKey(key);
                 staffDef->AddChild(meiKey);
                 if (staffDef->GetNotationtype() == NOTATIONTYPE_tab_guitar) meiKey->IsAttribute(true);
             }
 
             // staff details
-            pugi::xpath_node staffDetails;
-            xpath = StringFormat("staff-details[@number='%d']", i + 1);
-            staffDetails = child.select_node(xpath.c_str());
+            pugi::xml_node staffDetails = child.find_child_by_attribute("staff-details", "number", staffNumber.c_str());
             if (!staffDetails) {
-                staffDetails = child.select_node("staff-details[not(@number)]");
+                staffDetails = SelectChildWithoutAttribute(child, "staff-details", "number");
             }
-            short int staffLines = staffDetails.node().select_node("staff-lines").node().text().as_int();
+            short int staffLines = staffDetails.child("staff-lines").text().as_int();
             if (staffLines) {
                 staffDef->SetLines(staffLines);
             }
             else if (!staffDef->HasLines()) {
                 staffDef->SetLines(5);
             }
-            std::string scaleStr = staffDetails.node().select_node("staff-size").node().text().as_string();
+            std::string scaleStr = staffDetails.child("staff-size").text().as_string();
             if (!scaleStr.empty()) {
                 staffDef->SetScale(staffDef->AttScalable::StrToPercent(scaleStr + "%"));
             }
             // Tablature?
-            if (staffDetails.node().child("staff-tuning") || (staffDef->GetNotationtype() == NOTATIONTYPE_tab_guitar)) {
+            if (staffDetails.child("staff-tuning") || (staffDef->GetNotationtype() == NOTATIONTYPE_tab_guitar)) {
                 // tablature type.  MusicXML does not support German tablature.
-                if (HasAttributeWithValue(staffDetails.node(), "show-frets", "letters")) {
+                if (HasAttributeWithValue(staffDetails, "show-frets", "letters")) {
                     staffDef->SetNotationtype(NOTATIONTYPE_tab_lute_french);
                 }
                 else {
                     // Frets are notated with numbers.
                     // Italian tablature if the top staff line has a lower pitch than the bottom line
                     // else guitar tablature.
-                    pugi::xml_node topLine = staffDetails.node().find_child_by_attribute(
+                    pugi::xml_node topLine = staffDetails.find_child_by_attribute(
                         "staff-tuning", "line", std::to_string(staffLines).c_str());
-                    pugi::xml_node botLine = staffDetails.node().find_child_by_attribute("staff-tuning", "line", "1");
+                    pugi::xml_node botLine = staffDetails.find_child_by_attribute("staff-tuning", "line", "1");
                     if (topLine && botLine
                         && PitchToMidi(topLine.child("tuning-step").text().as_string(),
                                topLine.child("tuning-alter").text().as_int(),
@@ -1650,7 +1727,7 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
                 Tuning *tuning = new Tuning();
                 staffDef->AddChild(tuning);
 
-                for (pugi::xml_node staffTuning : staffDetails.node().children("staff-tuning")) {
+                for (pugi::xml_node staffTuning : staffDetails.children("staff-tuning")) {
                     Course *courseTuning = new Course();
                     tuning->AddChild(courseTuning);
 
@@ -1681,45 +1758,41 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
             }
 
             // time
-            pugi::xpath_node time;
-            xpath = StringFormat("time[@number='%d']", i + 1);
-            time = child.select_node(xpath.c_str());
+            pugi::xml_node time = child.find_child_by_attribute("time", "number", staffNumber.c_str());
             if (!time) {
-                time = child.select_node("time[not(@number)]");
-                if (nbStaves > 1) time.node().remove_attribute("id");
+                time = SelectChildWithoutAttribute(child, "time", "number");
+                if (nbStaves > 1) time.remove_attribute("id");
             }
             if (time) {
-                this->ReadMusicXMLMeterSig(time.node(), staffDef);
+                this->ReadMusicXMLMeterSig(time, staffDef);
             }
             // add it if necessary
 
             // transpose
-            pugi::xpath_node transpose;
-            xpath = StringFormat("transpose[@number='%d']", i + 1);
-            transpose = child.select_node(xpath.c_str());
+            pugi::xml_node transpose = child.find_child_by_attribute("transpose", "number", staffNumber.c_str());
             if (!transpose) {
-                transpose = child.select_node("transpose");
+                transpose = child.child("transpose");
             }
             if (transpose) {
-                staffDef->SetTransDiat(transpose.node().child("diatonic").text().as_int());
-                staffDef->SetTransSemi(transpose.node().child("chromatic").text().as_int());
-                if (transpose.node().child("octave-change")) {
-                    staffDef->SetTransDiat(transpose.node().child("chromatic").text().as_int()
-                        + 7 * transpose.node().child("octave-change").text().as_int());
-                    staffDef->SetTransSemi(transpose.node().child("chromatic").text().as_int()
-                        + 12 * transpose.node().child("octave-change").text().as_int());
+                staffDef->SetTransDiat(transpose.child("diatonic").text().as_int());
+                staffDef->SetTransSemi(transpose.child("chromatic").text().as_int());
+                if (transpose.child("octave-change")) {
+                    staffDef->SetTransDiat(transpose.child("chromatic").text().as_int()
+                        + 7 * transpose.child("octave-change").text().as_int());
+                    staffDef->SetTransSemi(transpose.child("chromatic").text().as_int()
+                        + 12 * transpose.child("octave-change").text().as_int());
                 }
             }
             // ppq
-            pugi::xpath_node divisions = child.select_node("divisions");
+            pugi::xml_node divisions = child.child("divisions");
             if (divisions) {
-                m_ppq = divisions.node().text().as_int();
+                m_ppq = divisions.text().as_int();
                 staffDef->SetPpq(m_ppq);
             }
             // measure style
-            pugi::xpath_node measureSlash = child.select_node("measure-style/slash");
+            pugi::xml_node measureSlash = SelectGrandchild(child, "measure-style", "slash");
             if (measureSlash) {
-                m_slash = (HasAttributeWithValue(measureSlash.node(), "type", "start")) ? true : false;
+                m_slash = (HasAttributeWithValue(measureSlash, "type", "start")) ? true : false;
             }
         }
     }
@@ -1730,17 +1803,17 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
 void MusicXmlInput::ReadMusicXMLMeterSig(const pugi::xml_node &time, Object *parent)
 {
     const bool invisible = HasAttributeWithValue(time, "print-object", "no");
-    if ((time.select_nodes("beats").size() > 1) || time.select_node("interchangeable")) {
+    const pugi::xml_node interchangeable = time.child("interchangeable");
+    if (time.child("beats").next_sibling("beats") || interchangeable) {
         MeterSigGrp *meterSigGrp = new MeterSigGrp();
         if (time.attribute("id")) {
             meterSigGrp->SetID(time.attribute("id").as_string());
         }
-        pugi::xpath_node interchangeable = time.select_node("interchangeable");
         meterSigGrp->SetFunc(interchangeable ? meterSigGrpLog_FUNC_interchanging : meterSigGrpLog_FUNC_mixed);
 
         std::tie(m_meterCount, m_meterUnit) = this->GetMeterSigGrpValues(time, meterSigGrp);
         if (interchangeable) {
-            std::tie(std::ignore, std::ignore) = this->GetMeterSigGrpValues(interchangeable.node(), meterSigGrp);
+            std::tie(std::ignore, std::ignore) = this->GetMeterSigGrpValues(interchangeable, meterSigGrp);
         }
         if (invisible) {
             meterSigGrp->SetVisible(BOOLEAN_false);
@@ -1894,11 +1967,15 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
     bool isMRestInOtherSystem = (mrestPositonIter != m_multiRests.end());
     int multiRestStaffNumber = 1;
 
+    const pugi::xml_node part = node.parent();
+    const bool isFirstPart = IsElement(part, "part") && !part.previous_sibling("part");
+
     // read the content of the measure
     for (pugi::xml_node child : node) {
         // first check if there is a multi measure rest
-        if (child.select_node(".//multiple-rest")) {
-            const pugi::xml_node multiRestNode = child.select_node(".//multiple-rest").node();
+        static const pugi::xpath_query multiRestQuery(".//multiple-rest");
+        const pugi::xml_node multiRestNode = child.select_node(multiRestQuery).node();
+        if (multiRestNode) {
             const int multiRestLength = multiRestNode.text().as_int();
             const std::string symbols = multiRestNode.attribute("use-symbols").as_string();
             MultiRest *multiRest = new MultiRest;
@@ -1953,7 +2030,7 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
             this->ReadMusicXmlNote(child, measure, measureNum, staffOffset, section);
         }
         // for now only check first part
-        else if (IsElement(child, "print") && node.select_node("parent::part[not(preceding-sibling::part)]")) {
+        else if (IsElement(child, "print") && isFirstPart) {
             this->ReadMusicXmlPrint(child, section);
         }
     }
@@ -2065,9 +2142,18 @@ void MusicXmlInput::ReadMusicXmlAttributes(
     pugi::xml_node key = node.child("key");
     pugi::xml_node time = node.child("time");
 
+    const pugi::xml_node part = SelectAncestor(node, "part");
+    bool isFirstKey = true;
+    for (pugi::xml_node attributes = node.previous_sibling("attributes"); attributes;
+         attributes = attributes.previous_sibling("attributes")) {
+        if (attributes.child("key")) {
+            isFirstKey = false;
+            break;
+        }
+    }
+
     // for now only read first key change in first part and update scoreDef
-    if ((key || time || divisionChange) && node.select_node("ancestor::part[not(preceding-sibling::part)]")
-        && !node.select_node("preceding-sibling::attributes/key")) {
+    if ((key || time || divisionChange) && part && !part.previous_sibling("part") && isFirstKey) {
         ScoreDef *scoreDef = new ScoreDef();
         if (key) {
             KeySig *meiKey = ConvertKey(key);
@@ -2084,17 +2170,17 @@ void MusicXmlInput::ReadMusicXmlAttributes(
 
         section->AddChild(scoreDef);
     }
-    else if (time && node.select_node("ancestor::part[(preceding-sibling::part)]")) {
+    else if (time && part && part.previous_sibling("part")) {
         m_meterUnit = time.child("beat-type").text().as_int();
     }
 
-    pugi::xpath_node measureRepeat = node.select_node("measure-style/measure-repeat");
-    pugi::xpath_node measureSlash = node.select_node("measure-style/slash");
+    pugi::xml_node measureRepeat = SelectGrandchild(node, "measure-style", "measure-repeat");
+    pugi::xml_node measureSlash = SelectGrandchild(node, "measure-style", "slash");
     if (measureRepeat) {
-        m_mRpt = (HasAttributeWithValue(measureRepeat.node(), "type", "start")) ? true : false;
+        m_mRpt = (HasAttributeWithValue(measureRepeat, "type", "start")) ? true : false;
     }
     if (measureSlash) {
-        m_slash = (HasAttributeWithValue(measureSlash.node(), "type", "start")) ? true : false;
+        m_slash = (HasAttributeWithValue(measureSlash, "type", "start")) ? true : false;
     }
 }
 
@@ -2117,12 +2203,12 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, c
     assert(staff);
 
     const std::string barStyle = node.child("bar-style").text().as_string();
-    pugi::xpath_node repeat = node.select_node("repeat");
+    pugi::xml_node repeat = node.child("repeat");
     int repeatTimes = 1;
     bool repeatAfterJump = false;
     if (repeat) {
-        repeatTimes = repeat.node().attribute("times").as_int(2);
-        repeatAfterJump = repeat.node().attribute("after-jump").as_bool(false);
+        repeatTimes = repeat.attribute("times").as_int(2);
+        repeatAfterJump = repeat.attribute("after-jump").as_bool(false);
     }
     if (!barStyle.empty()) {
         data_BARRENDITION barRendition = ConvertStyleToRend(barStyle, repeat);
@@ -2178,8 +2264,10 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, c
         std::string endingText = ending.text().as_string();
         if (endingType == "start") {
             // check for corresponding stop points
-            std::string xpath = StringFormat("following::ending[@number='%s'][@type != 'start']", endingNumber.c_str());
-            pugi::xpath_node endingEnd = node.select_node(xpath.c_str());
+            pugi::xml_node endingEnd = SelectFollowing(node, "ending", [&endingNumber](const pugi::xml_node end) {
+                return (end.attribute("number").as_string() == endingNumber) && end.attribute("type")
+                    && (std::string(end.attribute("type").as_string()) != "start");
+            });
             if (endingEnd) {
                 if (!m_sectionStart) m_sectionStart = musicxml::SectionInfo();
                 m_sectionStart->merge(musicxml::EndingInfo(endingNumber, endingType, endingText));
@@ -2236,7 +2324,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
     const std::string directionId = node.attribute("id").as_string();
 
     const pugi::xml_node typeNode = node.child("direction-type");
-    const pugi::xpath_node voice = node.select_node("voice");
+    const pugi::xml_node voice = node.child("voice");
     const short int offset = node.child("offset").text().as_int();
     const pugi::xml_node staffNode = node.child("staff");
     const pugi::xml_node soundNode = node.child("sound");
@@ -2281,7 +2369,8 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Dashes (to be connected with previous <dir> or <dynam> as @extender and @tstamp2 attribute
-    pugi::xpath_node dashes = typeNode.select_node("bracket|dashes");
+    static const pugi::xpath_query dashesQuery("bracket|dashes");
+    pugi::xpath_node dashes = typeNode.select_node(dashesQuery);
     if (dashes) {
         short int dashesNumber = dashes.node().attribute("number").as_int();
         dashesNumber = (dashesNumber < 1) ? 1 : dashesNumber;
@@ -2347,16 +2436,18 @@ void MusicXmlInput::ReadMusicXmlDirection(
         }
     }
 
-    pugi::xpath_node_set words = node.select_nodes("direction-type/words");
+    static const pugi::xpath_query wordsQuery("direction-type/words");
+    pugi::xpath_node_set words = node.select_nodes(wordsQuery);
     const bool containsWords = !words.empty();
     bool containsDynamics
-        = !node.select_node("direction-type/dynamics").node().empty() || soundNode.attribute("dynamics");
-    bool containsTempo = !node.select_node("direction-type/metronome").node().empty() || soundNode.attribute("tempo");
+        = !SelectGrandchild(node, "direction-type", "dynamics").empty() || soundNode.attribute("dynamics");
+    bool containsTempo = !SelectGrandchild(node, "direction-type", "metronome").empty() || soundNode.attribute("tempo");
 
     // Directive
     int defaultY = 0; // y position attribute, only for directives and dynamics
     if (containsWords && !containsTempo && !containsDynamics) {
-        pugi::xpath_node_set words = node.select_nodes("direction-type/*[self::words or self::coda or self::segno]");
+        static const pugi::xpath_query directiveQuery("direction-type/*[self::words or self::coda or self::segno]");
+        pugi::xpath_node_set words = node.select_nodes(directiveQuery);
         defaultY = words.first().node().attribute("default-y").as_int();
         defaultY = (defaultY * 10) + words.first().node().attribute("relative-y").as_int();
         std::string wordStr = words.first().node().text().as_string();
@@ -2410,7 +2501,8 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Coda & Segno
-    pugi::xpath_node xmlJump = typeNode.select_node("coda|segno");
+    static const pugi::xpath_query jumpQuery("coda|segno");
+    pugi::xpath_node xmlJump = typeNode.select_node(jumpQuery);
     if (xmlJump && !containsWords) {
         RepeatMark *mark = new RepeatMark();
         mark->SetPlace(mark->AttPlacementRelStaff::StrToStaffrel(placeStr.c_str()));
@@ -2427,8 +2519,9 @@ void MusicXmlInput::ReadMusicXmlDirection(
 
     // Dynamics
     if (containsDynamics) {
-        pugi::xpath_node_set dynamics = node.select_nodes(
-            containsWords ? "direction-type/dynamics|direction-type/words" : "direction-type/dynamics");
+        static const pugi::xpath_query dynamicsQuery("direction-type/dynamics");
+        static const pugi::xpath_query dynamicsAndWordsQuery("direction-type/dynamics|direction-type/words");
+        pugi::xpath_node_set dynamics = node.select_nodes(containsWords ? dynamicsAndWordsQuery : dynamicsQuery);
 
         dynamics.sort();
 
@@ -2487,7 +2580,8 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Hairpins
-    pugi::xpath_node_set wedges = node.select_nodes("direction-type/wedge");
+    static const pugi::xpath_query wedgesQuery("direction-type/wedge");
+    pugi::xpath_node_set wedges = node.select_nodes(wedgesQuery);
     for (pugi::xpath_node_set::const_iterator wedge = wedges.begin(); wedge != wedges.end(); ++wedge) {
         short int hairpinNumber = wedge->node().attribute("number").as_int();
         hairpinNumber = (hairpinNumber < 1) ? 1 : hairpinNumber;
@@ -2737,7 +2831,8 @@ void MusicXmlInput::ReadMusicXmlDirection(
         }
         tempo->SetPlace(tempo->AttPlacementRelStaff::StrToStaffrel(placeStr.c_str()));
         if (words.size() != 0) TextRendition(words, tempo);
-        pugi::xpath_node metronome = node.select_node("direction-type/metronome[not(@print-object='no')]");
+        static const pugi::xpath_query metronomeQuery("direction-type/metronome[not(@print-object='no')]");
+        pugi::xpath_node metronome = node.select_node(metronomeQuery);
         if (metronome) PrintMetronome(metronome.node(), tempo);
         if (soundNode.attribute("tempo")) {
             tempo->SetMidiBpm(soundNode.attribute("tempo").as_double());
@@ -2832,14 +2927,15 @@ void MusicXmlInput::ReadMusicXmlHarmony(pugi::xml_node node, Measure *measure, c
 
     int durOffset = 0;
 
-    std::string harmText = GetContentOfChild(node, "root/root-step");
-    pugi::xpath_node alter = node.select_node("root/root-alter");
+    const pugi::xml_node rootStep = SelectGrandchild(node, "root", "root-step");
+    std::string harmText = rootStep ? GetContent(rootStep) : "";
+    pugi::xml_node alter = SelectGrandchild(node, "root", "root-alter");
     if (harmText.empty()) {
-        pugi::xml_node numeral = node.select_node("numeral/numeral-root").node();
+        pugi::xml_node numeral = SelectGrandchild(node, "numeral", "numeral-root");
         harmText = numeral.attribute("text") ? numeral.attribute("text").as_string() : numeral.text().as_string();
-        alter = node.select_node("numeral/numeral-alter");
+        alter = SelectGrandchild(node, "numeral", "numeral-alter");
     }
-    if (alter) harmText += ConvertAlterToSymbol(GetContent(alter.node()));
+    if (alter) harmText += ConvertAlterToSymbol(GetContent(alter));
     pugi::xml_node kind = node.child("kind");
     if (kind) {
         if (HasAttributeWithValue(kind, "use-symbols", "yes")) {
@@ -2898,8 +2994,15 @@ void MusicXmlInput::ReadMusicXmlNote(
     assert(staff);
     // find staff's staffDef
     // TODO Tablature: is this the correct way to find a staff's staffDef?
-    AttNIntegerComparison cnc(STAFFDEF, staff->GetN());
-    StaffDef *staffDef = vrv_cast<StaffDef *>(m_doc->GetFirstScoreDef()->FindDescendantByComparison(&cnc));
+    StaffDef *staffDef = NULL;
+    if (m_staffDefsByN.contains(staff->GetN())) {
+        staffDef = m_staffDefsByN.at(staff->GetN());
+    }
+    else {
+        AttNIntegerComparison cnc(STAFFDEF, staff->GetN());
+        staffDef = vrv_cast<StaffDef *>(m_doc->GetFirstScoreDef()->FindDescendantByComparison(&cnc));
+        if (staffDef) m_staffDefsByN[staff->GetN()] = staffDef;
+    }
     bool isTablature = false;
     Tuning *tuning = NULL;
 
@@ -2932,49 +3035,61 @@ void MusicXmlInput::ReadMusicXmlNote(
         return;
     }
 
-    const pugi::xpath_node notations = node.select_node("notations[not(@print-object='no')]");
-
-    const bool cue = (node.child("cue") || node.select_node("type[@size='cue']")) ? true : false;
+    // collect the notations, cue and dots in a single pass over the children
+    pugi::xml_node notations;
+    bool cue = false;
+    int dots = 0;
+    for (pugi::xml_node child : node.children()) {
+        if (IsElement(child, "notations")) {
+            if (!notations && !HasAttributeWithValue(child, "print-object", "no")) notations = child;
+        }
+        else if (IsElement(child, "cue")) {
+            cue = true;
+        }
+        else if (IsElement(child, "type")) {
+            if (HasAttributeWithValue(child, "size", "cue")) cue = true;
+        }
+        else if (IsElement(child, "dot")) {
+            ++dots;
+        }
+    }
     pugi::xml_node grace = node.child("grace");
 
-    // duration string and dots
+    // duration string
     const std::string typeStr = node.child("type").text().as_string();
-    const int dots = (int)node.select_nodes("dot").size();
 
     short int tremSlashNum = -1;
 
     const bool readBeamsAndTuplets = ReadMusicXmlBeamsAndTuplets(node, layer, isChord);
 
     // beam start
-    bool beamStart = node.select_node("beam[@number='1'][text()='begin']");
+    bool beamStart = SelectBeam(node, "begin", "1");
     // tremolos
-    pugi::xpath_node tremolo = notations.node().select_node("ornaments/tremolo");
+    pugi::xml_node tremolo = SelectGrandchild(notations, "ornaments", "tremolo");
 
     if (tremolo) {
-        if (HasAttributeWithValue(tremolo.node(), "type", "start")) {
+        if (HasAttributeWithValue(tremolo, "type", "start")) {
             if (!isChord) {
                 FTrem *fTrem = new FTrem();
                 this->AddLayerElement(layer, fTrem);
                 m_elementStackMap.at(layer).push_back(fTrem);
-                int beamFloatNum = tremolo.node().text().as_int(); // number of floating beams
+                int beamFloatNum = tremolo.text().as_int(); // number of floating beams
                 int beamAttachedNum = 0; // number of attached beams
                 while (beamStart && beamAttachedNum < 8) { // count number of (attached) beams, max 8
-                    std::ostringstream o;
-                    o << "beam[@number='" << ++beamAttachedNum + 1 << "'][text()='begin']";
-                    beamStart = node.select_node(o.str().c_str());
+                    beamStart = SelectBeam(node, "begin", std::to_string(++beamAttachedNum + 1));
                 }
                 fTrem->SetBeams(beamFloatNum + beamAttachedNum);
                 fTrem->SetBeamsFloat(beamFloatNum);
             }
         }
-        else if (!HasAttributeWithValue(tremolo.node(), "type", "stop")) {
+        else if (!HasAttributeWithValue(tremolo, "type", "stop")) {
             // this is default tremolo type in MusicXML
-            tremSlashNum = tremolo.node().text().as_int();
+            tremSlashNum = tremolo.text().as_int();
             if (!isChord) {
                 BTrem *bTrem = new BTrem();
                 this->AddLayerElement(layer, bTrem);
                 m_elementStackMap.at(layer).push_back(bTrem);
-                if (HasAttributeWithValue(tremolo.node(), "type", "unmeasured")) {
+                if (HasAttributeWithValue(tremolo, "type", "unmeasured")) {
                     bTrem->SetForm(tremForm_FORM_unmeas);
                     tremSlashNum = 0;
                 }
@@ -3100,7 +3215,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         // accidental
         pugi::xml_node accidental = node.child("accidental");
         if (!accidental) {
-            accidental = node.select_node("notations/accidental-mark").node();
+            accidental = SelectGrandchild(node, "notations", "accidental-mark");
         }
         if (accidental) {
             Accid *accid = new Accid();
@@ -3185,8 +3300,8 @@ void MusicXmlInput::ReadMusicXmlNote(
         if (node.child("notehead-text")) LogWarning("MusicXML import: notehead-text is not supported");
 
         // look at the next note to see if we are starting or ending a chord
-        pugi::xpath_node nextNote = node.select_node("./following-sibling::note");
-        if (nextNote.node().child("chord")) nextIsChord = true;
+        pugi::xml_node nextNote = node.next_sibling("note");
+        if (nextNote.child("chord")) nextIsChord = true;
         Chord *chord = NULL;
         TabGrp *tabGrp = NULL;
         if (isTablature) {
@@ -3404,7 +3519,8 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // slurs
-        pugi::xpath_node_set slurs = node.select_nodes("notations/slur");
+        static const pugi::xpath_query slursQuery("notations/slur");
+        pugi::xpath_node_set slurs = node.select_nodes(slursQuery);
         for (pugi::xpath_node_set::const_iterator it = slurs.begin(); it != slurs.end(); ++it) {
             pugi::xml_node slur = it->node();
             short int slurNumber = slur.attribute("number").as_int();
@@ -3432,7 +3548,7 @@ void MusicXmlInput::ReadMusicXmlNote(
 
         // articulation
         std::list<Artic *> artics;
-        for (pugi::xml_node articulations : notations.node().children("articulations")) {
+        for (pugi::xml_node articulations : notations.children("articulations")) {
             for (pugi::xml_node articulation : articulations.children()) {
                 Artic *artic = new Artic();
                 data_ARTICULATION articVal = ConvertArticulations(articulation.name());
@@ -3463,7 +3579,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         artics.clear();
 
         // technical
-        for (pugi::xml_node technical : notations.node().children("technical")) {
+        for (pugi::xml_node technical : notations.children("technical")) {
             for (pugi::xml_node technicalChild : technical.children()) {
                 const std::string technicalChildName = technicalChild.name();
 
@@ -3552,31 +3668,31 @@ void MusicXmlInput::ReadMusicXmlNote(
     m_ID = "#" + element->GetID();
 
     // breath marks
-    pugi::xpath_node xmlBreath = notations.node().select_node("articulations/breath-mark");
+    pugi::xml_node xmlBreath = SelectGrandchild(notations, "articulations", "breath-mark");
     if (xmlBreath) {
         Breath *breath = new Breath();
         m_controlElements.push_back({ measureNum, breath });
         breath->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         breath->SetPlace(
-            breath->AttPlacementRelStaff::StrToStaffrel(xmlBreath.node().attribute("placement").as_string()));
-        breath->SetColor(xmlBreath.node().attribute("color").as_string());
+            breath->AttPlacementRelStaff::StrToStaffrel(xmlBreath.attribute("placement").as_string()));
+        breath->SetColor(xmlBreath.attribute("color").as_string());
         breath->SetTstamp((double)(m_durTotal) * (double)m_meterUnit / (double)(4 * m_ppq) + 0.5);
     }
 
     // caesura
-    pugi::xpath_node xmlCaesura = notations.node().select_node("articulations/caesura");
+    pugi::xml_node xmlCaesura = SelectGrandchild(notations, "articulations", "caesura");
     if (xmlCaesura) {
         Caesura *caesura = new Caesura();
         m_controlElements.push_back({ measureNum, caesura });
         caesura->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         caesura->SetPlace(
-            caesura->AttPlacementRelStaff::StrToStaffrel(xmlCaesura.node().attribute("placement").as_string()));
-        caesura->SetColor(xmlCaesura.node().attribute("color").as_string());
+            caesura->AttPlacementRelStaff::StrToStaffrel(xmlCaesura.attribute("placement").as_string()));
+        caesura->SetColor(xmlCaesura.attribute("color").as_string());
         caesura->SetTstamp((double)(m_durTotal) * (double)m_meterUnit / (double)(4 * m_ppq) + 0.5);
     }
 
     // dynamics
-    pugi::xml_node xmlDynam = notations.node().child("dynamics");
+    pugi::xml_node xmlDynam = notations.child("dynamics");
     if (xmlDynam) {
         Dynam *dynam = new Dynam();
         m_controlElements.push_back({ measureNum, dynam });
@@ -3605,7 +3721,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // fermatas
-    pugi::xml_node xmlFermata = notations.node().child("fermata");
+    pugi::xml_node xmlFermata = notations.child("fermata");
     if (xmlFermata) {
         Fermata *fermata = new Fermata();
         m_controlElements.push_back({ measureNum, fermata });
@@ -3616,9 +3732,9 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // fingering
-    auto xmlFing = notations.node().select_node("technical/fingering");
+    pugi::xml_node xmlFing = SelectGrandchild(notations, "technical", "fingering");
     if (xmlFing) {
-        const std::string fingText = xmlFing.node().text().as_string();
+        const std::string fingText = xmlFing.text().as_string();
         Fing *fing = new Fing();
         Text *text = new Text();
         text->SetText(UTF8to32(fingText));
@@ -3626,12 +3742,13 @@ void MusicXmlInput::ReadMusicXmlNote(
         const std::string startID = note ? ("#" + note->GetID()) : m_ID;
         fing->SetStartid(startID);
         fing->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
-        fing->SetPlace(fing->AttPlacementRelStaff::StrToStaffrel(xmlFing.node().attribute("placement").as_string()));
+        fing->SetPlace(fing->AttPlacementRelStaff::StrToStaffrel(xmlFing.attribute("placement").as_string()));
         fing->AddChild(text);
     }
 
     // glissando and slide
-    pugi::xpath_node_set glissandi = notations.node().select_nodes("glissando|slide");
+    static const pugi::xpath_query glissandiQuery("glissando|slide");
+    pugi::xpath_node_set glissandi = notations.select_nodes(glissandiQuery);
     for (pugi::xpath_node_set::const_iterator it = glissandi.begin(); it != glissandi.end(); ++it) {
         std::string noteID = m_ID;
         // prevent from using chords or tabGrps
@@ -3665,7 +3782,8 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // mordents
-    pugi::xpath_node xmlMordent = notations.node().select_node("ornaments/*[contains(name(), 'mordent')]");
+    static const pugi::xpath_query mordentQuery("ornaments/*[contains(name(), 'mordent')]");
+    pugi::xpath_node xmlMordent = notations.select_node(mordentQuery);
     if (xmlMordent) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back({ measureNum, mordent });
@@ -3683,7 +3801,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         if (!std::strncmp(xmlMordent.node().name(), "inverted", 7)) {
             mordent->SetForm(mordentLog_FORM_upper);
         }
-        for (pugi::xml_node xmlAccidMark : notations.node().children("accidental-mark")) {
+        for (pugi::xml_node xmlAccidMark : notations.children("accidental-mark")) {
             const data_ACCIDENTAL_WRITTEN accid = ConvertAccidentalToAccid(xmlAccidMark.text().as_string());
             if (HasAttributeWithValue(xmlAccidMark, "placement", "above")) {
                 mordent->SetAccidupper(accid);
@@ -3717,8 +3835,9 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // schleifer/haydn (counts as mordent with different glyph)
-    pugi::xpath_node xmlExtOrnament
-        = notations.node().select_node("ornaments/*[contains(name(), 'schleifer') or contains(name(), 'haydn')]");
+    static const pugi::xpath_query extOrnamentQuery(
+        "ornaments/*[contains(name(), 'schleifer') or contains(name(), 'haydn')]");
+    pugi::xpath_node xmlExtOrnament = notations.select_node(extOrnamentQuery);
     if (xmlExtOrnament) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back({ measureNum, mordent });
@@ -3735,30 +3854,30 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // trill
-    pugi::xpath_node xmlTrill = notations.node().select_node("ornaments/trill-mark");
-    pugi::xpath_node xmlTrillLine = notations.node().select_node("ornaments/wavy-line[@type='start']");
+    pugi::xml_node xmlTrill = SelectGrandchild(notations, "ornaments", "trill-mark");
+    pugi::xml_node xmlTrillLine = SelectGrandchild(notations, "ornaments", "wavy-line", "type", "start");
     if (xmlTrill || xmlTrillLine) {
         Trill *trill = new Trill();
         m_controlElements.push_back({ measureNum, trill });
         trill->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         trill->SetStartid(m_ID);
         // color
-        trill->SetColor(xmlTrill.node().attribute("color").as_string());
+        trill->SetColor(xmlTrill.attribute("color").as_string());
         // place
-        trill->SetPlace(trill->AttPlacementRelStaff::StrToStaffrel(xmlTrill.node().attribute("placement").as_string()));
+        trill->SetPlace(trill->AttPlacementRelStaff::StrToStaffrel(xmlTrill.attribute("placement").as_string()));
         if (xmlTrillLine) {
             trill->SetExtender(BOOLEAN_true);
-            trill->SetN(xmlTrillLine.node().attribute("number").as_string());
+            trill->SetN(xmlTrillLine.attribute("number").as_string());
             if (!xmlTrill) {
                 trill->SetLstartsym(LINESTARTENDSYMBOL_none);
-                trill->SetColor(xmlTrillLine.node().attribute("color").as_string());
+                trill->SetColor(xmlTrillLine.attribute("color").as_string());
                 trill->SetPlace(
-                    trill->AttPlacementRelStaff::StrToStaffrel(xmlTrillLine.node().attribute("placement").as_string()));
+                    trill->AttPlacementRelStaff::StrToStaffrel(xmlTrillLine.attribute("placement").as_string()));
             }
             musicxml::OpenSpanner openTrill(1, m_measureCounts.at(measure));
             m_trillStack.push_back({ trill, openTrill });
         }
-        for (pugi::xml_node xmlAccidMark = xmlTrill.node().next_sibling("accidental-mark"); xmlAccidMark;
+        for (pugi::xml_node xmlAccidMark = xmlTrill.next_sibling("accidental-mark"); xmlAccidMark;
             xmlAccidMark = xmlAccidMark.next_sibling("accidental-mark")) {
             if (HasAttributeWithValue(xmlAccidMark, "placement", "below")) {
                 trill->SetAccidlower(ConvertAccidentalToAccid(xmlAccidMark.text().as_string()));
@@ -3768,9 +3887,9 @@ void MusicXmlInput::ReadMusicXmlNote(
             }
         }
     }
-    if (!m_trillStack.empty() && notations.node().select_node("ornaments/wavy-line[@type='stop']")) {
-        short int extNumber
-            = notations.node().select_node("ornaments/wavy-line[@type='stop']").node().attribute("number").as_int();
+    pugi::xml_node xmlTrillLineStop = SelectGrandchild(notations, "ornaments", "wavy-line", "type", "stop");
+    if (!m_trillStack.empty() && xmlTrillLineStop) {
+        short int extNumber = xmlTrillLineStop.attribute("number").as_int();
         std::vector<std::pair<Trill *, musicxml::OpenSpanner>>::iterator iter = m_trillStack.begin();
         while (iter != m_trillStack.end()) {
             const int measureDifference = m_measureCounts.at(measure) - iter->second.m_lastMeasureCount;
@@ -3787,7 +3906,8 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // turns
-    pugi::xpath_node xmlTurn = notations.node().select_node("ornaments/*[contains(name(), 'turn')]");
+    static const pugi::xpath_query turnQuery("ornaments/*[contains(name(), 'turn')]");
+    pugi::xpath_node xmlTurn = notations.select_node(turnQuery);
     if (xmlTurn) {
         Turn *turn = new Turn();
         m_controlElements.push_back({ measureNum, turn });
@@ -3831,7 +3951,8 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // arpeggio
-    pugi::xpath_node xmlArpeggiate = notations.node().select_node("*[contains(name(), 'arpeggiate')]");
+    static const pugi::xpath_query arpeggiateQuery("*[contains(name(), 'arpeggiate')]");
+    pugi::xpath_node xmlArpeggiate = notations.select_node(arpeggiateQuery);
     if (xmlArpeggiate) {
         short int arpegN = xmlArpeggiate.node().attribute("number").as_int();
         arpegN = (arpegN < 1) ? 1 : arpegN;
@@ -3875,24 +3996,27 @@ void MusicXmlInput::ReadMusicXmlNote(
 
     // tremolo end
     if (tremolo) {
-        if (HasAttributeWithValue(tremolo.node(), "type", "stop")) {
+        if (HasAttributeWithValue(tremolo, "type", "stop")) {
             this->RemoveLastFromStack(FTREM, layer);
         }
-        else if (!HasAttributeWithValue(tremolo.node(), "type", "start") && !isChord) {
+        else if (!HasAttributeWithValue(tremolo, "type", "start") && !isChord) {
             this->RemoveLastFromStack(BTREM, layer);
         }
     }
 
     // tuplet end
-    pugi::xpath_node tupletEnd = node.select_node("notations/tuplet[@type='stop']");
+    pugi::xml_node tupletEnd = SelectGrandchild(node, "notations", "tuplet", "type", "stop");
     if (tupletEnd) {
         this->RemoveLastFromStack(TUPLET, layer);
     }
 
     // beam end
-    bool beamEnd = node.select_node("beam[text()='end']");
+    bool beamEnd = SelectBeam(node, "end");
     if (beamEnd) {
-        int breakSec = (int)node.select_nodes("beam[text()='continue']").size();
+        int breakSec = 0;
+        for (pugi::xml_node beam : node.children("beam")) {
+            if (HasContentWithValue(beam, "continue")) ++breakSec;
+        }
         if (breakSec) {
             if (element->Is(NOTE)) {
                 Note *note = vrv_cast<Note *>(element);
@@ -4055,75 +4179,68 @@ void MusicXmlInput::ReadMusicXmlSound(pugi::xml_node node, Measure *measure)
 
 bool MusicXmlInput::ReadMusicXmlBeamsAndTuplets(const pugi::xml_node &node, Layer *layer, bool isChord)
 {
-    pugi::xpath_node beamStart = node.select_node("beam[@number='1' and text()='begin']");
-    pugi::xpath_node tupletStart = node.select_node("notations/tuplet[@type='start']");
-    pugi::xpath_node currentMeasure = node.select_node("ancestor::measure");
-
-    pugi::xml_node beamEnd = node.select_node("./following-sibling::note[beam[@number='1' and text()='end']]").node();
-    pugi::xml_node tupletEnd = node.select_node("./following-sibling::note[notations/tuplet[@type='stop']]").node();
+    pugi::xml_node beamStart = SelectBeam(node, "begin", "1");
+    pugi::xml_node tupletStart = SelectGrandchild(node, "notations", "tuplet", "type", "start");
+    if (!beamStart && !tupletStart) return true;
+
+    // walk the following notes up to the end of the beam and look for tuplets starting or ending within it
+    pugi::xml_node beamEnd;
+    bool isTupletStartInBeam = false;
+    bool isTupletEndInBeam = false;
+    bool isTupletEndingWithBeam = false;
+    for (pugi::xml_node sibling = node.next_sibling("note"); sibling; sibling = sibling.next_sibling("note")) {
+        const bool isTupletEnd = SelectGrandchild(sibling, "notations", "tuplet", "type", "stop");
+        if (isTupletEnd && !isTupletEndInBeam) {
+            isTupletEndInBeam = true;
+            isTupletEndingWithBeam = SelectBeam(sibling, "end", "1");
+        }
+        if (SelectGrandchild(sibling, "notations", "tuplet", "type", "start")) isTupletStartInBeam = true;
+        if (SelectBeam(sibling, "end", "1")) {
+            beamEnd = sibling;
+            break;
+        }
+    }
 
-    const auto measureNodeChildren = currentMeasure.node().children();
-    std::vector<pugi::xml_node> currentMeasureNodes(measureNodeChildren.begin(), measureNodeChildren.end());
     // in case note is a start of both beam and tuplet - need to figure which one is longer
     if (beamStart && tupletStart) {
-        const auto beamEndIterator = std::find(currentMeasureNodes.begin(), currentMeasureNodes.end(), beamEnd);
-        const auto tupletEndIterator = std::find(currentMeasureNodes.begin(), currentMeasureNodes.end(), tupletEnd);
-
-        // find distance between iterator, i.e. whether beam or tuplet ends first.
-        // Negative number - beam ends first, positive - tuplet, zero - both are of the same length
-        const int distance = static_cast<int>(std::distance(beamEndIterator, tupletEndIterator));
-        if (distance > 0) {
-            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart.node(), layer);
-            this->ReadMusicXmlBeamStart(node, beamStart.node(), layer);
+        // the tuplet is longer if the beam ends before the tuplet, i.e. no tuplet end was found until the beam end
+        if (beamEnd && !isTupletEndInBeam) {
+            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart, layer);
+            this->ReadMusicXmlBeamStart(node, beamStart, layer);
         }
         else {
-            this->ReadMusicXmlBeamStart(node, beamStart.node(), layer);
-            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart.node(), layer);
+            this->ReadMusicXmlBeamStart(node, beamStart, layer);
+            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart, layer);
         }
     }
     // If note is a start of the beam only - check if there is a tuplet starting/ending in the span of
     // the whole duration of this beam
     else if (beamStart) {
-        // find whether there is a tuplet that starts during the span of the beam
-        pugi::xpath_node nextTupletStart
-            = node.select_node("./following-sibling::note[notations/tuplet[@type='start']]").node();
-
-        // find start and end of the beam
-        const auto beamStartIterator = std::find(currentMeasureNodes.begin(), currentMeasureNodes.end(), node);
-        const auto beamEndIterator = std::find(beamStartIterator, currentMeasureNodes.end(), beamEnd);
-
         // find staff number for the corresponding elements - we do not want to match beam start on one staff with beam
         // end on another
-        pugi::xpath_node nodeStaff = node.select_node("staff");
-        pugi::xpath_node endBeamStaff = beamEnd.select_node("staff");
-
-        if (beamEndIterator == currentMeasureNodes.end()
-            || (nodeStaff && endBeamStaff
-                && (nodeStaff.node().text().as_int() != endBeamStaff.node().text().as_int()))) {
-            std::string measureName = (currentMeasure.node().attribute("id"))
-                ? currentMeasure.node().attribute("id").as_string()
-                : currentMeasure.node().attribute("number").as_string();
+        pugi::xml_node nodeStaff = node.child("staff");
+        pugi::xml_node endBeamStaff = beamEnd.child("staff");
+
+        if (!beamEnd || (nodeStaff && endBeamStaff && (nodeStaff.text().as_int() != endBeamStaff.text().as_int()))) {
+            pugi::xml_node currentMeasure = SelectAncestor(node, "measure");
+            std::string measureName = (currentMeasure.attribute("id")) ? currentMeasure.attribute("id").as_string()
+                                                                       : currentMeasure.attribute("number").as_string();
             LogDebug("MusicXML import: Beam without end in measure %s treated as <beamSpan>", measureName.c_str());
             return false;
         }
-        // form vector of the beam nodes and find whether there are tuplets that start or end within the beam
-        std::vector<pugi::xml_node> beamNodes(beamStartIterator, beamEndIterator + 1);
-        bool isTupletStartInBeam
-            = (beamNodes.end() != std::find(beamNodes.begin(), beamNodes.end(), nextTupletStart.node()));
-        bool isTupletEndInBeam = (beamNodes.end() != std::find(beamNodes.begin(), beamNodes.end(), tupletEnd));
         // in case if there is only start/end of the tuplet in the beam, then we need to use beamSpan instead
-        if ((tupletEnd != beamEnd) && (isTupletStartInBeam != isTupletEndInBeam)) {
+        if (!isTupletEndingWithBeam && (isTupletStartInBeam != isTupletEndInBeam)) {
             // TODO: same call as in else-case is intentional. Proper beamSpan support will need to be implemented
             // before this case can be handled correctly
-            this->ReadMusicXmlBeamStart(node, beamStart.node(), layer);
+            this->ReadMusicXmlBeamStart(node, beamStart, layer);
         }
         else {
-            this->ReadMusicXmlBeamStart(node, beamStart.node(), layer);
+            this->ReadMusicXmlBeamStart(node, beamStart, layer);
         }
     }
     // no special logic needed if we have just tupletStart - just read it as is
     else if (tupletStart) {
-        if (!isChord) ReadMusicXmlTupletStart(node, tupletStart.node(), layer);
+        if (!isChord) ReadMusicXmlTupletStart(node, tupletStart, layer);
     }
 
     return true;
@@ -4138,11 +4255,11 @@ void MusicXmlInput::ReadMusicXmlTupletStart(const pugi::xml_node &node, const pu
     Tuplet *tuplet = new Tuplet();
     this->AddLayerElement(layer, tuplet);
     m_elementStackMap.at(layer).push_back(tuplet);
-    short int num = node.select_node("time-modification/actual-notes").node().text().as_int();
-    short int numbase = node.select_node("time-modification/normal-notes").node().text().as_int();
+    short int num = SelectGrandchild(node, "time-modification", "actual-notes").text().as_int();
+    short int numbase = SelectGrandchild(node, "time-modification", "normal-notes").text().as_int();
     if (tupletStart.first_child()) {
-        num = tupletStart.select_node("tuplet-actual/tuplet-number").node().text().as_int();
-        numbase = tupletStart.select_node("tuplet-normal/tuplet-number").node().text().as_int();
+        num = SelectGrandchild(tupletStart, "tuplet-actual", "tuplet-number").text().as_int();
+        numbase = SelectGrandchild(tupletStart, "tuplet-normal", "tuplet-number").text().as_int();
     }
     if (num) tuplet->SetNum(num);
     if (numbase) tuplet->SetNumbase(numbase);
@@ -4155,7 +4272,8 @@ void MusicXmlInput::ReadMusicXmlTupletStart(const pugi::xml_node &node, const pu
 
 void MusicXmlInput::ReadMusicXmlBeamStart(const pugi::xml_node &node, const pugi::xml_node &beamStart, Layer *layer)
 {
-    if (!beamStart || (node.select_node("notations/ornaments/tremolo[@type='start']"))) return;
+    static const pugi::xpath_query tremoloStartQuery("notations/ornaments/tremolo[@type='start']");
+    if (!beamStart || (node.select_node(tremoloStartQuery))) return;
     if (m_elementStackMap.at(layer).size() > 0 && m_elementStackMap.at(layer).back()->Is(BEAM)) {
         LogDebug("MusicXML import: Adding a beam to a beam");
         if (!node.child("grace")) return;
@@ -4171,7 +4289,8 @@ void MusicXmlInput::ReadMusicXmlBeamStart(const pugi::xml_node &node, const pugi
 void MusicXmlInput::ReadMusicXmlTies(
     const pugi::xml_node &node, Layer *layer, Note *note, const std::string &measureNum)
 {
-    pugi::xpath_node_set xmlTies = node.select_nodes("notations/tied");
+    static const pugi::xpath_query tiesQuery("notations/tied");
+    pugi::xpath_node_set xmlTies = node.select_nodes(tiesQuery);
     for (pugi::xpath_node_set::const_iterator it = xmlTies.begin(); it != xmlTies.end(); ++it) {
         pugi::xml_node xmlTie = (*it).node();
         std::string tieType = xmlTie.attribute("type").as_string();
@@ -5023,8 +5142,10 @@ bool MusicXmlInput::IsMultirestMeasure(int index) const
 
 std::pair<std::vector<int>, int> MusicXmlInput::GetMeterSigGrpValues(const pugi::xml_node &node, MeterSigGrp *parent)
 {
-    pugi::xpath_node_set beats = node.select_nodes("beats");
-    pugi::xpath_node_set beat_type = node.select_nodes("beat-type");
+    static const pugi::xpath_query beatsQuery("beats");
+    static const pugi::xpath_query beatTypeQuery("beat-type");
+    pugi::xpath_node_set beats = node.select_nodes(beatsQuery);
+    pugi::xpath_node_set beat_type = node.select_nodes(beatTypeQuery);
     int maxUnit = 0;
     std::vector<int> meterCounts;
     for (auto iter1 = beats.begin(), iter2 = beat_type.begin(); (iter1 != beats.end()) && (iter2 != beat_type.end());
@@ -5061,6 +5182,13 @@ std::pair<std::vector<int>, int> MusicXmlInput::GetMeterSigGrpValues(const pugi:
     return { meterCounts, maxUnit };
 }
 
+const std::vector<Measure *> &MusicXmlInput::GetMeasuresByN(const std::string &n) const
+{
+    static const std::vector<Measure *> noMeasures;
+    auto iter = m_measuresByN.find(n);
+    return (iter != m_measuresByN.end()) ? iter->second : noMeasures;
+}
+
 int MusicXmlInput::GetMrestMeasuresCountBeforeIndex(int index) const
 {
     int count = 0;
@@ -118,6 +118,11 @@ void Measure::CloneReset()
 
     // owned pointers need to be set to NULL;
     m_drawingScoreDef = NULL;
+
+    // The cached horizontal layout is not valid for the copy
+    m_cachedXRel = VRV_UNSET;
+    m_cachedOverflow = VRV_UNSET;
+    m_cachedWidth = VRV_UNSET;
 }
 
 void Measure::Reset()
@@ -203,6 +208,7 @@ bool Measure::AddChildBack(Object *child)
             }
         }
     }
+    this->IndexChild(child);
     this->Modify();
 
     return true;
@@ -519,9 +525,7 @@ const Staff *Measure::GetLastStaff(bool excludeOStaves) const
 int Measure::EnclosesTime(int time) const
 {
     int repeat = 1;
-    double timeDuration
-        = m_measureAligner.GetRightAlignment()->GetTime().ToDouble() * SCORE_TIME_UNIT * 60.0 / m_currentTempo * 1000.0
-        + 0.5;
+    double timeDuration = this->GetRealTimeDurationMilliseconds();
     std::vector<double>::const_iterator iter;
     for (iter = m_realTimeOnsetMilliseconds.begin(); iter != m_realTimeOnsetMilliseconds.end(); ++iter) {
         if ((time >= *iter) && (time <= *iter + timeDuration)) return repeat;
@@ -530,6 +534,13 @@ int Measure::EnclosesTime(int time) const
     return VRV_UNSET;
 }
 
+double Measure::GetRealTimeDurationMilliseconds() const
+{
+    return m_measureAligner.GetRightAlignment()->GetTime().ToDouble() * SCORE_TIME_UNIT * 60.0 / m_currentTempo
+        * 1000.0
+        + 0.5;
+}
+
 Fraction Measure::GetScoreTimeOnset(int repeat) const
 {
     if (m_scoreTimeOnset.empty() || (repeat > (int)m_scoreTimeOnset.size())) return 0;
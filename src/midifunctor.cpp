@@ -578,6 +578,7 @@ InitMIDIFunctor::InitMIDIFunctor() : ConstFunctor()
 FunctorCode InitMIDIFunctor::VisitMeasure(const Measure *measure)
 {
     m_currentTempo = measure->GetCurrentTempo();
+    m_trackObjects.push_back(measure);
 
     return FUNCTOR_CONTINUE;
 }
@@ -607,6 +608,36 @@ FunctorCode InitMIDIFunctor::VisitOctave(const Octave *octave)
     return FUNCTOR_CONTINUE;
 }
 
+FunctorCode InitMIDIFunctor::VisitPedal(const Pedal *pedal)
+{
+    m_trackObjects.push_back(pedal);
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode InitMIDIFunctor::VisitScoreDef(const ScoreDef *scoreDef)
+{
+    // The content of the scoreDef is processed with it
+    m_trackObjects.push_back(scoreDef);
+
+    return FUNCTOR_SIBLINGS;
+}
+
+FunctorCode InitMIDIFunctor::VisitStaff(const Staff *staff)
+{
+    // Nothing to collect within the staff
+    m_trackObjects.push_back(staff);
+
+    return FUNCTOR_SIBLINGS;
+}
+
+FunctorCode InitMIDIFunctor::VisitStaffDef(const StaffDef *staffDef)
+{
+    m_trackObjects.push_back(staffDef);
+
+    return FUNCTOR_SIBLINGS;
+}
+
 //----------------------------------------------------------------------------
 // GenerateMIDIFunctor
 //----------------------------------------------------------------------------
@@ -182,4 +182,88 @@ FunctorCode ReorderByXPosFunctor::VisitObject(Object *object)
     return FUNCTOR_CONTINUE;
 }
 
+//----------------------------------------------------------------------------
+// CompositeFunctor
+//----------------------------------------------------------------------------
+
+CompositeFunctor::CompositeFunctor(const std::vector<Functor *> &functors) : Functor()
+{
+    m_functors = functors;
+    m_skippingFrom.resize(m_functors.size(), NULL);
+
+    // Subtrees can be skipped only if all the functors declare the classes they visit
+    ClassIdSet classIds;
+    for (Functor *functor : m_functors) {
+        assert(!functor->GetFilters() && (functor->GetDirection() == FORWARD));
+        if (!functor->GetClassIds()) return;
+        classIds |= *functor->GetClassIds();
+    }
+    this->SetClassIdSet(classIds);
+}
+
+FunctorCode CompositeFunctor::VisitObject(Object *object)
+{
+    bool hasVisited = false;
+    for (int i = 0; i < (int)m_functors.size(); ++i) {
+        Functor *functor = m_functors.at(i);
+        bool visited = false;
+        // Same as in Object::Process for a single functor
+        if (!m_skippingFrom.at(i) && (functor->GetCode() != FUNCTOR_STOP)) {
+            functor->SetCode(object->Accept(*functor));
+            if (functor->GetCode() == FUNCTOR_SIBLINGS) {
+                functor->SetCode(FUNCTOR_CONTINUE);
+                m_skippingFrom.at(i) = object;
+            }
+            else {
+                visited = true;
+            }
+        }
+        m_visited.push_back(visited);
+        hasVisited = (hasVisited || visited);
+    }
+
+    // No need to go deeper if none of the functors visited the object
+    if (!hasVisited) {
+        this->ResumeFunctors(object);
+        if (this->GetCompositeCode() == FUNCTOR_CONTINUE) {
+            m_visited.resize(m_visited.size() - m_functors.size());
+            return FUNCTOR_SIBLINGS;
+        }
+    }
+
+    // With FUNCTOR_STOP the end of the object is still visited, as in Object::Process
+    return this->GetCompositeCode();
+}
+
+FunctorCode CompositeFunctor::VisitObjectEnd(Object *object)
+{
+    const int offset = (int)m_visited.size() - (int)m_functors.size();
+    assert(offset >= 0);
+    for (int i = 0; i < (int)m_functors.size(); ++i) {
+        Functor *functor = m_functors.at(i);
+        if (m_visited.at(offset + i) && functor->ImplementsEndInterface()) {
+            functor->SetCode(object->AcceptEnd(*functor));
+        }
+    }
+    m_visited.resize(offset);
+    this->ResumeFunctors(object);
+
+    return this->GetCompositeCode();
+}
+
+void CompositeFunctor::ResumeFunctors(const Object *object)
+{
+    for (const Object *&skippingFrom : m_skippingFrom) {
+        if (skippingFrom == object) skippingFrom = NULL;
+    }
+}
+
+FunctorCode CompositeFunctor::GetCompositeCode() const
+{
+    for (int i = 0; i < (int)m_functors.size(); ++i) {
+        if (!m_skippingFrom.at(i) && (m_functors.at(i)->GetCode() != FUNCTOR_STOP)) return FUNCTOR_CONTINUE;
+    }
+    return FUNCTOR_STOP;
+}
+
 } // namespace vrv
@@ -168,6 +168,7 @@ bool Note::AddChild(Object *child)
     else {
         children.push_back(child);
     }
+    this->IndexChild(child);
     this->Modify();
 
     return true;
@@ -97,11 +97,14 @@ Object::Object(const Object &object) : BoundingBox(object)
 
     m_classId = object.m_classId;
     m_parent = NULL;
+    m_idIndexDoc = NULL;
+    m_idxInParent = VRV_UNSET;
 
     // Flags
     m_isAttribute = object.m_isAttribute;
     m_isModified = true;
     m_isReferenceObject = object.m_isReferenceObject;
+    m_subtreeClassIdsValid = false;
 
     // Also copy attribute classes
     m_attClasses = object.m_attClasses;
@@ -138,15 +141,21 @@ Object &Object::operator=(const Object &object)
 {
     // not self assignement
     if (this != &object) {
+        // Remove it from the ID index because the children and the id are going to change
+        Doc *idIndexDoc = m_idIndexDoc;
+        this->RemoveFromIDIndex();
+
         this->ClearChildren();
         this->ResetBoundingBox(); // It does not make sense to keep the values of the BBox
 
         m_classId = object.m_classId;
         m_parent = NULL;
+        m_idxInParent = VRV_UNSET;
         // Flags
         m_isAttribute = object.m_isAttribute;
         m_isModified = true;
         m_isReferenceObject = object.m_isReferenceObject;
+        this->InvalidateSubtreeClassIds();
 
         // Also copy attribute classes
         m_attClasses = object.m_attClasses;
@@ -170,6 +179,8 @@ Object &Object::operator=(const Object &object)
                 }
             }
         }
+
+        if (idIndexDoc) this->AddToIDIndex(idIndexDoc);
     }
     return *this;
 }
@@ -177,16 +188,21 @@ Object &Object::operator=(const Object &object)
 Object::~Object()
 {
     this->ClearChildren();
+
+    if (m_idIndexDoc) m_idIndexDoc->UnindexID(this);
 }
 
 void Object::Init(ClassId classId)
 {
     m_classId = classId;
     m_parent = NULL;
+    m_idIndexDoc = NULL;
+    m_idxInParent = VRV_UNSET;
     // Flags
     m_isAttribute = false;
     m_isModified = true;
     m_isReferenceObject = false;
+    m_subtreeClassIdsValid = false;
     // Comments
     m_comment = "";
     m_closingComment = "";
@@ -294,8 +310,10 @@ void Object::ReplaceChild(Object *currentChild, Object *replacingChild)
 
     int idx = this->GetChildIndex(currentChild);
     currentChild->ResetParent();
+    currentChild->RemoveFromIDIndex();
     m_children.at(idx) = replacingChild;
     replacingChild->SetParent(this);
+    this->IndexChild(replacingChild);
     this->Modify();
 }
 
@@ -338,6 +356,18 @@ void Object::MoveItselfTo(Object *targetParent)
     targetParent->AddChild(relinquishedObject);
 }
 
+void Object::SetID(const std::string &id)
+{
+    if (m_idIndexDoc) {
+        m_idIndexDoc->UnindexID(this);
+        m_id = id;
+        m_idIndexDoc->IndexID(this);
+    }
+    else {
+        m_id = id;
+    }
+}
+
 void Object::SwapID(Object *other)
 {
     assert(other);
@@ -496,14 +526,12 @@ Object *Object::GetNext(const Object *child, const ClassId classId)
 
 const Object *Object::GetNext(const Object *child, const ClassId classId) const
 {
-    ArrayOfObjects::const_iterator iteratorEnd, iteratorCurrent;
-    iteratorEnd = m_children.end();
-    iteratorCurrent = std::find(m_children.begin(), iteratorEnd, child);
-    if (iteratorCurrent != iteratorEnd) {
-        ++iteratorCurrent;
-        iteratorCurrent = std::find_if(iteratorCurrent, iteratorEnd, ObjectComparison(classId));
-    }
-    return (iteratorCurrent == iteratorEnd) ? NULL : *iteratorCurrent;
+    const int idx = this->GetChildIndex(child);
+    if (idx == -1) return NULL;
+
+    ArrayOfObjects::const_iterator iteratorCurrent
+        = std::find_if(m_children.begin() + idx + 1, m_children.end(), ObjectComparison(classId));
+    return (iteratorCurrent == m_children.end()) ? NULL : *iteratorCurrent;
 }
 
 Object *Object::GetPrevious(const Object *child, const ClassId classId)
@@ -513,14 +541,12 @@ Object *Object::GetPrevious(const Object *child, const ClassId classId)
 
 const Object *Object::GetPrevious(const Object *child, const ClassId classId) const
 {
-    ArrayOfObjects::const_reverse_iterator riteratorEnd, riteratorCurrent;
-    riteratorEnd = m_children.rend();
-    riteratorCurrent = std::find(m_children.rbegin(), riteratorEnd, child);
-    if (riteratorCurrent != riteratorEnd) {
-        ++riteratorCurrent;
-        riteratorCurrent = std::find_if(riteratorCurrent, riteratorEnd, ObjectComparison(classId));
-    }
-    return (riteratorCurrent == riteratorEnd) ? NULL : *riteratorCurrent;
+    const int idx = this->GetChildIndex(child);
+    if (idx == -1) return NULL;
+
+    ArrayOfObjects::const_reverse_iterator riteratorCurrent
+        = std::find_if(m_children.rbegin() + (m_children.size() - idx), m_children.rend(), ObjectComparison(classId));
+    return (riteratorCurrent == m_children.rend()) ? NULL : *riteratorCurrent;
 }
 
 Object *Object::GetLast(const ClassId classId)
@@ -547,6 +573,7 @@ void Object::InsertChild(Object *element, int idx)
     // With this method we require the parent to be NULL
     assert(!element->GetParent());
     element->SetParent(this);
+    this->IndexChild(element);
 
     if (idx >= (int)m_children.size()) {
         m_children.push_back(element);
@@ -568,6 +595,7 @@ Object *Object::DetachChild(int idx)
     }
     Object *child = m_children.at(idx);
     child->ResetParent();
+    child->RemoveFromIDIndex();
     ArrayOfObjects::iterator iter = m_children.begin();
     m_children.erase(iter + (idx));
     return child;
@@ -604,6 +632,7 @@ Object *Object::Relinquish(int idx)
     }
     Object *child = m_children.at(idx);
     child->ResetParent();
+    child->RemoveFromIDIndex();
     return child;
 }
 
@@ -627,12 +656,58 @@ Object *Object::FindDescendantByID(const std::string &id, int deepness, bool dir
 
 const Object *Object::FindDescendantByID(const std::string &id, int deepness, bool direction) const
 {
+    const Object *descendant = NULL;
+    if ((deepness == UNLIMITED_DEPTH) && this->FindIndexedDescendantByID(id, descendant)) {
+#ifdef CHECK_ID_INDEX
+        FindByIDFunctor findByIDCheck(id);
+        findByIDCheck.SetDirection(direction);
+        this->Process(findByIDCheck, deepness, true);
+        if (findByIDCheck.GetElement() != descendant) {
+            LogError("ID index mismatch for '%s' in '%s'", id.c_str(), this->GetID().c_str());
+            assert(false);
+        }
+#endif
+        return descendant;
+    }
+
     FindByIDFunctor findByID(id);
     findByID.SetDirection(direction);
     this->Process(findByID, deepness, true);
     return findByID.GetElement();
 }
 
+bool Object::FindIndexedDescendantByID(const std::string &id, const Object *&descendant) const
+{
+    descendant = NULL;
+    // The children of a reference object are not indexed through it
+    if (!m_idIndexDoc || m_isReferenceObject) return false;
+
+    int count = 0;
+    const Object *object = m_idIndexDoc->GetIndexedObject(id, count);
+    // Not in the index, which means it is not in the tree
+    if (count == 0) return true;
+    // With duplicated ids we need to traverse the tree to get the first one
+    if (count > 1) return false;
+    // The search does not include the object itself
+    if (object == this) return true;
+
+    // Go up to make sure the object is a descendant reached by the traversal (i.e., not hidden)
+    bool isHidden = false;
+    const Object *ancestor = object->m_parent;
+    const Object *last = object;
+    while (ancestor) {
+        if (ancestor->SkipChildren(true)) isHidden = true;
+        if (ancestor == this) {
+            if (!isHidden) descendant = object;
+            return true;
+        }
+        last = ancestor;
+        ancestor = ancestor->m_parent;
+    }
+    // Not a descendant, but we can be sure only if the object is in the tree of the document
+    return (last == m_idIndexDoc);
+}
+
 Object *Object::FindDescendantByType(ClassId classId, int deepness, bool direction)
 {
     return const_cast<Object *>(std::as_const(*this).FindDescendantByType(classId, deepness, direction));
@@ -828,13 +903,62 @@ void Object::GenerateID()
 
 void Object::ResetID()
 {
-    this->GenerateID();
+    if (m_idIndexDoc) {
+        m_idIndexDoc->UnindexID(this);
+        this->GenerateID();
+        m_idIndexDoc->IndexID(this);
+    }
+    else {
+        this->GenerateID();
+    }
+}
+
+void Object::AddToIDIndex(Doc *doc)
+{
+    assert(doc);
+
+    // Already indexed, and so are all its descendants
+    if (m_idIndexDoc == doc) return;
+    // Indexed in another document
+    if (m_idIndexDoc) this->RemoveFromIDIndex();
+
+    m_idIndexDoc = doc;
+    doc->IndexID(this);
+
+    if (m_isReferenceObject) return;
+
+    for (Object *child : m_children) {
+        // Skip children that were relinquished
+        if (child->m_parent == this) child->AddToIDIndex(doc);
+    }
+}
+
+void Object::RemoveFromIDIndex()
+{
+    if (!m_idIndexDoc) return;
+
+    m_idIndexDoc->UnindexID(this);
+    m_idIndexDoc = NULL;
+
+    if (m_isReferenceObject) return;
+
+    for (Object *child : m_children) {
+        if (child->m_parent == this) child->RemoveFromIDIndex();
+    }
+}
+
+void Object::IndexChild(Object *child)
+{
+    assert(child);
+
+    if (m_idIndexDoc && !m_isReferenceObject) child->AddToIDIndex(m_idIndexDoc);
 }
 
 void Object::SetParent(Object *parent)
 {
     assert(!m_parent);
     m_parent = parent;
+    if (m_parent) m_parent->InvalidateSubtreeClassIds();
 }
 
 bool Object::IsSupportedChild(ClassId classId)
@@ -870,6 +994,7 @@ bool Object::AddChild(Object *child)
         i = std::min(i, (int)m_children.size());
         m_children.insert(m_children.begin() + i, child);
     }
+    this->IndexChild(child);
     this->Modify();
 
     return true;
@@ -916,14 +1041,20 @@ void Object::ResetCachedDrawingY() const
 
 int Object::GetChildIndex(const Object *child) const
 {
-    ArrayOfObjects::const_iterator iter;
-    int i;
-    for (iter = m_children.begin(), i = 0; iter != m_children.end(); ++iter, ++i) {
-        if (child == *iter) {
-            return i;
-        }
+    if (!child) return -1;
+
+    const int hint = child->m_idxInParent;
+    if ((hint >= 0) && (hint < (int)m_children.size()) && (m_children.at(hint) == child)) {
+        return hint;
     }
-    return -1;
+
+    // The hint is not valid (children were added or removed before it), renumber all of them
+    int idx = -1;
+    for (int i = 0; i < (int)m_children.size(); ++i) {
+        m_children.at(i)->m_idxInParent = i;
+        if ((idx == -1) && (m_children.at(i) == child)) idx = i;
+    }
+    return idx;
 }
 
 int Object::GetDescendantIndex(const Object *child, const ClassId classId, int depth)
@@ -944,6 +1075,39 @@ void Object::Modify(bool modified) const
         m_parent->Modify();
     }
     m_isModified = modified;
+    if (modified) m_subtreeClassIdsValid = false;
+}
+
+bool Object::HasClassInSubtree(const ClassIdSet &classIds) const
+{
+    return (this->GetSubtreeClassIds() & classIds).any();
+}
+
+const ClassIdSet &Object::GetSubtreeClassIds() const
+{
+    if (!m_subtreeClassIdsValid) {
+        m_subtreeClassIds.reset();
+        // The children of a reference object do not propagate their modifications to it
+        if (m_isReferenceObject) {
+            m_subtreeClassIds.set();
+        }
+        else {
+            m_subtreeClassIds.set(m_classId);
+            for (const Object *child : m_children) {
+                m_subtreeClassIds |= child->GetSubtreeClassIds();
+            }
+        }
+        m_subtreeClassIdsValid = true;
+    }
+    return m_subtreeClassIds;
+}
+
+void Object::InvalidateSubtreeClassIds() const
+{
+    // No need to go further up since the ancestors of an invalid object are invalid too
+    for (const Object *object = this; object && object->m_subtreeClassIdsValid; object = object->m_parent) {
+        object->m_subtreeClassIdsValid = false;
+    }
 }
 
 void Object::FillFlatList(ListOfConstObjects &flatList) const
@@ -1070,6 +1234,22 @@ void Object::Process(Functor &functor, int deepness, bool skipFirst)
         return;
     }
 
+    // When profiling, the top-level call is timed and the visits are counted
+    if (functor.GetProfiler() && !functor.IsProfiling()) {
+        functor.StartProfiling();
+        this->Process(functor, deepness, skipFirst);
+        functor.StopProfiling();
+        return;
+    }
+
+    // Skip the subtree if it contains none of the classes visited by the functor
+    const ClassIdSet *classIds = functor.GetClassIds();
+    if (classIds && !this->HasClassInSubtree(*classIds)) {
+        return;
+    }
+
+    if (functor.IsProfiling()) functor.CountVisit();
+
     if (!skipFirst) {
         FunctorCode code = this->Accept(functor);
         functor.SetCode(code);
@@ -1124,6 +1304,22 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
         return;
     }
 
+    // When profiling, the top-level call is timed and the visits are counted
+    if (functor.GetProfiler() && !functor.IsProfiling()) {
+        functor.StartProfiling();
+        this->Process(functor, deepness, skipFirst);
+        functor.StopProfiling();
+        return;
+    }
+
+    // Skip the subtree if it contains none of the classes visited by the functor
+    const ClassIdSet *classIds = functor.GetClassIds();
+    if (classIds && !this->HasClassInSubtree(*classIds)) {
+        return;
+    }
+
+    if (functor.IsProfiling()) functor.CountVisit();
+
     if (!skipFirst) {
         FunctorCode code = this->Accept(functor);
         functor.SetCode(code);
@@ -964,7 +964,7 @@ Options::Options()
 
     m_outputTo.SetInfo("Output to",
         "Select output format to: \"mei\", \"mei-pb\", \"mei-facs\", \"mei-basic\", \"svg\", \"midi\", \"timemap\", "
-        "\"expansionmap\", \"humdrum\", \"pae\" or \"mei-pb-serialized\"");
+        "\"expansionmap\", \"humdrum\", \"pae\", \"mei-pb-serialized\" or \"mei-pb-binary\"");
     m_outputTo.Init("svg");
     m_outputTo.SetKey("outputTo");
     m_outputTo.SetShortOption('t', true);
@@ -1127,6 +1127,10 @@ Options::Options()
     m_preserveAnalyticalMarkup.Init(false);
     this->Register(&m_preserveAnalyticalMarkup, "preserveAnalyticalMarkup", &m_general);
 
+    m_profile.SetInfo("Profile", "Collect the time spent in each processing phase and functor");
+    m_profile.Init(false);
+    this->Register(&m_profile, "profile", &m_general);
+
     m_removeIds.SetInfo("Remove IDs in MEI", "Remove XML IDs in the MEI output that are not referenced");
     m_removeIds.Init(false);
     this->Register(&m_removeIds, "removeIds", &m_general);
@@ -1188,12 +1192,21 @@ Options::Options()
     m_svgRemoveXlink.Init(false);
     this->Register(&m_svgRemoveXlink, "svgRemoveXlink", &m_general);
 
+    m_svgStream.SetInfo("Stream SVG output",
+        "Write each system to the SVG output once drawn instead of keeping the full SVG tree until the end");
+    m_svgStream.Init(false);
+    this->Register(&m_svgStream, "svgStream", &m_general);
+
     m_svgAdditionalAttribute.SetInfo("Add additional attribute in SVG",
         "Add additional attribute for graphical elements in SVG as \"data-*\", for "
         "example, \"note@pname\" would add a \"data-pname\" to all note elements");
     m_svgAdditionalAttribute.Init();
     this->Register(&m_svgAdditionalAttribute, "svgAdditionalAttribute", &m_general);
 
+    m_threads.SetInfo("Threads", "The number of threads for rendering all pages to SVG on command-line");
+    m_threads.Init(1, 1, 64);
+    this->Register(&m_threads, "threads", &m_general);
+
     m_unit.SetInfo("Unit", "The MEI unit (1⁄2 of the distance between the staff lines)");
     m_unit.Init(DEFAULT_UNIT, 4.5, 12.0, true);
     this->Register(&m_unit, "unit", &m_general);
@@ -1314,6 +1327,10 @@ Options::Options()
     m_fontLoadAll.Init(false);
     this->Register(&m_fontLoadAll, "fontLoadAll", &m_generalLayout);
 
+    m_fontPreload.SetInfo("Font preload", "Preload the glyphs of the music font for the SVG output");
+    m_fontPreload.Init(false);
+    this->Register(&m_fontPreload, "fontPreload", &m_generalLayout);
+
     m_fontTextLiberation.SetInfo("Font text Liberation", "Use the Liberation text font");
     m_fontTextLiberation.Init(false);
     this->Register(&m_fontTextLiberation, "fontTextLiberation", &m_generalLayout);
@@ -1978,7 +1995,7 @@ bool Options::SetOutputTo(std::string const &outputTo)
     else if (outputTo == "pae") {
         m_outputToFormat = PAE;
     }
-    else if (outputTo == "mei-pb-serialized") {
+    else if ((outputTo == "mei-pb-serialized") || (outputTo == "mei-pb-binary")) {
         m_outputToFormat = SERIALIZATION;
     }
     else if (outputTo != "svg") {
@@ -227,13 +227,16 @@ void Page::LayOut()
         return;
     }
 
+    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
+    assert(doc);
+
+    ProfileScope profileScope(doc->GetProfiler(), "LayOut");
+
     this->LayOutHorizontally();
     this->JustifyHorizontally();
     this->LayOutVertically();
     this->JustifyVertically();
 
-    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
-    assert(doc);
     if (doc->GetOptions()->m_svgBoundingBoxes.GetValue()) {
         View view;
         view.SetDoc(doc);
@@ -288,11 +291,11 @@ void Page::LayOutTranscription(bool force)
     CalcStemFunctor calcStem(doc);
     this->Process(calcStem);
 
+    // The dots depend on the flipped noteheads of the same note only
     CalcChordNoteHeadsFunctor calcChordNoteHeads(doc);
-    this->Process(calcChordNoteHeads);
-
     CalcDotsFunctor calcDots(doc);
-    this->Process(calcDots);
+    CompositeFunctor calcNoteHeadsAndDots({ &calcChordNoteHeads, &calcDots });
+    this->Process(calcNoteHeadsAndDots);
 
     if (!m_layoutDone) {
         // Render it for filling the bounding box
@@ -305,9 +308,9 @@ void Page::LayOutTranscription(bool force)
     }
 
     AdjustXRelForTranscriptionFunctor adjustXRelForTranscription;
-    this->Process(adjustXRelForTranscription);
     AdjustYRelForTranscriptionFunctor adjustYRelForTranscription;
-    this->Process(adjustYRelForTranscription);
+    CompositeFunctor adjustRelForTranscription({ &adjustXRelForTranscription, &adjustYRelForTranscription });
+    this->Process(adjustRelForTranscription);
 
     CalcLedgerLinesFunctor calcLedgerLines(doc);
     this->Process(calcLedgerLines);
@@ -315,6 +318,22 @@ void Page::LayOutTranscription(bool force)
     m_layoutDone = true;
 }
 
+void Page::ResetTemporalAligners()
+{
+    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
+    assert(doc);
+
+    // Reset the horizontal alignment
+    ResetHorizontalAlignmentFunctor resetHorizontalAlignment;
+    this->Process(resetHorizontalAlignment);
+
+    // Align the content of the page using measure aligners
+    // After this:
+    // - each LayerElement object will have its Alignment pointer initialized with its time
+    AlignHorizontallyFunctor alignHorizontally(doc);
+    this->Process(alignHorizontally);
+}
+
 void Page::ResetAligners()
 {
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
@@ -376,15 +395,13 @@ void Page::ResetAligners()
     CalcStemFunctor calcStem(doc);
     this->Process(calcStem);
 
+    // The dots depend on the flipped noteheads of the same note only, and the outside articulations on
+    // the stems. Since the slur direction and spanning beamSpans depend on other notes, they run afterwards.
     CalcChordNoteHeadsFunctor calcChordNoteHeads(doc);
-    this->Process(calcChordNoteHeads);
-
     CalcDotsFunctor calcDots(doc);
-    this->Process(calcDots);
-
-    // Adjust the position of outside articulations
     CalcArticFunctor calcArtic(doc);
-    this->Process(calcArtic);
+    CompositeFunctor calcNoteHeadsDotsAndArtic({ &calcChordNoteHeads, &calcDots, &calcArtic });
+    this->Process(calcNoteHeadsDotsAndArtic);
 
     CalcSlurDirectionFunctor calcSlurDirection(doc);
     this->Process(calcSlurDirection);
@@ -398,6 +415,8 @@ void Page::LayOutHorizontally()
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
+    ProfileScope profileScope(doc->GetProfiler(), "LayOutHorizontally");
+
     // Make sure we have the correct page size
     assert(doc->CheckPageSize(this));
 
@@ -511,6 +530,8 @@ void Page::LayOutVertically()
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
+    ProfileScope profileScope(doc->GetProfiler(), "LayOutVertically");
+
     // Make sure we have the correct page size
     assert(doc->CheckPageSize(this));
 
@@ -527,6 +548,11 @@ void Page::LayOutVertically()
     AlignVerticallyFunctor alignVertically(doc);
     this->Process(alignVertically);
 
+    // Index the layer elements of each system for finding the elements spanned by slurs
+    for (Object *child : this->GetChildren()) {
+        if (child->Is(SYSTEM)) vrv_cast<System *>(child)->BuildLayerElementIndex();
+    }
+
     // Render it for filling the bounding box
     View view;
     BBoxDeviceContext bBoxDC(&view, 0, 0);
@@ -592,6 +618,11 @@ void Page::LayOutVertically()
         this->Process(adjustSlurs);
     }
 
+    // The layer elements can change after the layout, so the index must not be kept
+    for (Object *child : this->GetChildren()) {
+        if (child->Is(SYSTEM)) vrv_cast<System *>(child)->ClearLayerElementIndex();
+    }
+
     if (this->GetHeader()) {
         this->GetHeader()->AdjustRunningElementYPos();
     }
@@ -612,6 +643,8 @@ void Page::JustifyHorizontally()
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
+    ProfileScope profileScope(doc->GetProfiler(), "JustifyHorizontally");
+
     if ((doc->GetOptions()->m_breaks.GetValue() == BREAKS_none) || doc->GetOptions()->m_noJustification.GetValue()) {
         return;
     }
@@ -637,6 +670,8 @@ void Page::JustifyVertically()
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
+    ProfileScope profileScope(doc->GetProfiler(), "JustifyVertically");
+
     // Make sure we have the correct page size
     assert(doc->CheckPageSize(this));
 
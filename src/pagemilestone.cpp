@@ -76,6 +76,11 @@ void PageMilestoneInterface::ConvertToPageBasedMilestone(Object *object, Object
     object->ClearRelinquishedChildren();
 }
 
+void PageMilestoneInterface::ConvertToScoreBasedContainer()
+{
+    m_end = NULL;
+}
+
 //----------------------------------------------------------------------------
 // PageMilestoneEnd functor methods
 //----------------------------------------------------------------------------
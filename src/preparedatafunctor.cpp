@@ -933,7 +933,10 @@ FunctorCode PrepareTimestampsFunctor::VisitMeasureEnd(Measure *measure)
 // PreparePedalsFunctor
 //----------------------------------------------------------------------------
 
-PreparePedalsFunctor::PreparePedalsFunctor(Doc *doc) : DocFunctor(doc) {}
+PreparePedalsFunctor::PreparePedalsFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetClassIds({ MEASURE, PEDAL });
+}
 
 FunctorCode PreparePedalsFunctor::VisitMeasureEnd(Measure *measure)
 {
@@ -984,14 +987,31 @@ FunctorCode PreparePedalsFunctor::VisitPedal(Pedal *pedal)
 
 PreparePointersByLayerFunctor::PreparePointersByLayerFunctor() : Functor()
 {
-    m_currentElement = NULL;
-    m_lastDot = NULL;
+    m_currentState = NULL;
 }
 
 FunctorCode PreparePointersByLayerFunctor::VisitDot(Dot *dot)
 {
-    dot->m_drawingPreviousElement = m_currentElement;
-    m_lastDot = dot;
+    if (!m_currentState) return FUNCTOR_CONTINUE;
+
+    dot->m_drawingPreviousElement = m_currentState->currentElement;
+    m_currentState->lastDot = dot;
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode PreparePointersByLayerFunctor::VisitLayer(Layer *layer)
+{
+    Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+    assert(staff);
+    m_currentState = &m_layerStates[{ staff->GetN(), layer->GetN() }];
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode PreparePointersByLayerFunctor::VisitLayerEnd(Layer *layer)
+{
+    m_currentState = NULL;
 
     return FUNCTOR_CONTINUE;
 }
@@ -1000,17 +1020,19 @@ FunctorCode PreparePointersByLayerFunctor::VisitLayerElement(LayerElement *layer
 {
     if (layerElement->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
 
+    if (!m_currentState) return FUNCTOR_CONTINUE;
+
     // Skip ligatures because we want it attached to the first note in it
-    if (m_lastDot && !layerElement->Is(LIGATURE)) {
-        m_lastDot->m_drawingNextElement = layerElement;
-        m_lastDot = NULL;
+    if (m_currentState->lastDot && !layerElement->Is(LIGATURE)) {
+        m_currentState->lastDot->m_drawingNextElement = layerElement;
+        m_currentState->lastDot = NULL;
     }
     if (layerElement->Is(BARLINE)) {
         // Do not attach a note when a barline is passed
-        m_currentElement = NULL;
+        m_currentState->currentElement = NULL;
     }
     else if (layerElement->Is({ NOTE, REST })) {
-        m_currentElement = layerElement;
+        m_currentState->currentElement = layerElement;
     }
 
     return FUNCTOR_CONTINUE;
@@ -1018,9 +1040,11 @@ FunctorCode PreparePointersByLayerFunctor::VisitLayerElement(LayerElement *layer
 
 FunctorCode PreparePointersByLayerFunctor::VisitMeasureEnd(Measure *measure)
 {
-    if (m_lastDot) {
-        m_lastDot->m_drawingNextElement = measure->GetRightBarLine();
-        m_lastDot = NULL;
+    for (auto &[staffLayerN, layerState] : m_layerStates) {
+        if (layerState.lastDot) {
+            layerState.lastDot->m_drawingNextElement = measure->GetRightBarLine();
+            layerState.lastDot = NULL;
+        }
     }
 
     return FUNCTOR_CONTINUE;
@@ -1032,44 +1056,68 @@ FunctorCode PreparePointersByLayerFunctor::VisitMeasureEnd(Measure *measure)
 
 PrepareLyricsFunctor::PrepareLyricsFunctor() : Functor()
 {
-    m_currentSyl = NULL;
-    m_lastNoteOrChord = NULL;
-    m_penultimateNoteOrChord = NULL;
+    m_currentState = NULL;
+}
+
+void PrepareLyricsFunctor::CloseSyl(Doc *doc, Syl *syl, LayerElement *lastNoteOrChord) const
+{
+    if (lastNoteOrChord && (syl->GetStart() != lastNoteOrChord)) {
+        syl->SetEnd(lastNoteOrChord);
+    }
+    else if (doc->GetOptions()->m_openControlEvents.GetValue()) {
+        sylLog_WORDPOS wordpos = syl->GetWordpos();
+        if ((wordpos == sylLog_WORDPOS_i) || (wordpos == sylLog_WORDPOS_m)) {
+            Measure *lastMeasure = vrv_cast<Measure *>(doc->FindDescendantByType(MEASURE, UNLIMITED_DEPTH, BACKWARD));
+            assert(lastMeasure);
+            syl->SetEnd(lastMeasure->GetRightBarLine());
+        }
+    }
 }
 
 FunctorCode PrepareLyricsFunctor::VisitChord(Chord *chord)
 {
-    m_penultimateNoteOrChord = m_lastNoteOrChord;
-    m_lastNoteOrChord = chord;
+    if (!m_currentState) return FUNCTOR_CONTINUE;
+
+    m_currentState->penultimateNoteOrChord = m_currentState->lastNoteOrChord;
+    m_currentState->lastNoteOrChord = chord;
 
     return FUNCTOR_CONTINUE;
 }
 
 FunctorCode PrepareLyricsFunctor::VisitDocEnd(Doc *doc)
 {
-    if (!m_currentSyl) {
-        return FUNCTOR_STOP; // early return
-    }
-    if (m_lastNoteOrChord && (m_currentSyl->GetStart() != m_lastNoteOrChord)) {
-        m_currentSyl->SetEnd(m_lastNoteOrChord);
-    }
-    else if (doc->GetOptions()->m_openControlEvents.GetValue()) {
-        sylLog_WORDPOS wordpos = m_currentSyl->GetWordpos();
-        if ((wordpos == sylLog_WORDPOS_i) || (wordpos == sylLog_WORDPOS_m)) {
-            Measure *lastMeasure = vrv_cast<Measure *>(doc->FindDescendantByType(MEASURE, UNLIMITED_DEPTH, BACKWARD));
-            assert(lastMeasure);
-            m_currentSyl->SetEnd(lastMeasure->GetRightBarLine());
+    for (auto &[staffLayerN, layerState] : m_layerStates) {
+        for (auto &[verseN, currentSyl] : layerState.currentSyls) {
+            if (currentSyl) this->CloseSyl(doc, currentSyl, layerState.lastNoteOrChord);
         }
     }
 
     return FUNCTOR_STOP;
 }
 
+FunctorCode PrepareLyricsFunctor::VisitLayer(Layer *layer)
+{
+    Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+    assert(staff);
+    m_currentState = &m_layerStates[{ staff->GetN(), layer->GetN() }];
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode PrepareLyricsFunctor::VisitLayerEnd(Layer *layer)
+{
+    m_currentState = NULL;
+
+    return FUNCTOR_CONTINUE;
+}
+
 FunctorCode PrepareLyricsFunctor::VisitNote(Note *note)
 {
+    if (!m_currentState) return FUNCTOR_CONTINUE;
+
     if (!note->IsChordTone()) {
-        m_penultimateNoteOrChord = m_lastNoteOrChord;
-        m_lastNoteOrChord = note;
+        m_currentState->penultimateNoteOrChord = m_currentState->lastNoteOrChord;
+        m_currentState->lastNoteOrChord = note;
     }
 
     return FUNCTOR_CONTINUE;
@@ -1077,11 +1125,16 @@ FunctorCode PrepareLyricsFunctor::VisitNote(Note *note)
 
 FunctorCode PrepareLyricsFunctor::VisitSyl(Syl *syl)
 {
+    // Only syl in verses are processed, each verse @n separately
     Verse *verse = vrv_cast<Verse *>(syl->GetFirstAncestor(VERSE, MAX_NOTE_DEPTH));
-    if (verse) {
-        syl->m_drawingVerseN = std::max(verse->GetN(), 1);
-        syl->m_drawingVersePlace = verse->GetPlace();
-    }
+    if (!verse || !m_currentState) return FUNCTOR_CONTINUE;
+
+    syl->m_drawingVerseN = std::max(verse->GetN(), 1);
+    syl->m_drawingVersePlace = verse->GetPlace();
+
+    Syl *&currentSyl = m_currentState->currentSyls[verse->GetN()];
+    LayerElement *lastNoteOrChord = m_currentState->lastNoteOrChord;
+    LayerElement *penultimateNoteOrChord = m_currentState->penultimateNoteOrChord;
 
     syl->SetStart(vrv_cast<LayerElement *>(syl->GetFirstAncestor(NOTE, MAX_NOTE_DEPTH)));
     // If there isn't an ancestor note, it should be a chord
@@ -1090,35 +1143,35 @@ FunctorCode PrepareLyricsFunctor::VisitSyl(Syl *syl)
     }
 
     // At this stage currentSyl is actually the previous one that is ending here
-    if (m_currentSyl) {
+    if (currentSyl) {
         // The previous syl was an initial or median -> The note we just parsed is the end
-        if ((m_currentSyl->GetWordpos() == sylLog_WORDPOS_i) || (m_currentSyl->GetWordpos() == sylLog_WORDPOS_m)) {
-            m_currentSyl->SetEnd(m_lastNoteOrChord);
-            m_currentSyl->m_nextWordSyl = syl;
+        if ((currentSyl->GetWordpos() == sylLog_WORDPOS_i) || (currentSyl->GetWordpos() == sylLog_WORDPOS_m)) {
+            currentSyl->SetEnd(lastNoteOrChord);
+            currentSyl->m_nextWordSyl = syl;
         }
         // The previous syl was a underscore -> the previous but one was the end
-        else if (m_currentSyl->GetCon() == sylLog_CON_u) {
-            if (m_currentSyl->GetStart() == m_penultimateNoteOrChord) {
+        else if (currentSyl->GetCon() == sylLog_CON_u) {
+            if (currentSyl->GetStart() == penultimateNoteOrChord) {
                 LogWarning("Syllable with underline extender under one single note '%s'",
-                    m_currentSyl->GetStart()->GetID().c_str());
+                    currentSyl->GetStart()->GetID().c_str());
             }
             else {
-                m_currentSyl->SetEnd(m_penultimateNoteOrChord);
+                currentSyl->SetEnd(penultimateNoteOrChord);
             }
         }
     }
 
     // Now decide what to do with the starting syl and check if it has a forward connector
     if ((syl->GetWordpos() == sylLog_WORDPOS_i) || (syl->GetWordpos() == sylLog_WORDPOS_m)) {
-        m_currentSyl = syl;
+        currentSyl = syl;
         return FUNCTOR_CONTINUE;
     }
     else if (syl->GetCon() == sylLog_CON_u) {
-        m_currentSyl = syl;
+        currentSyl = syl;
         return FUNCTOR_CONTINUE;
     }
     else {
-        m_currentSyl = NULL;
+        currentSyl = NULL;
     }
 
     return FUNCTOR_CONTINUE;
@@ -1386,44 +1439,49 @@ Flag *PrepareLayerElementPartsFunctor::ProcessFlag(Flag *flag, Object *parent, b
 
 PrepareRptFunctor::PrepareRptFunctor(Doc *doc) : DocFunctor(doc)
 {
+    m_currentStaffN = VRV_UNSET;
     m_currentMRpt = NULL;
-    m_multiNumber = BOOLEAN_NONE;
 }
 
 FunctorCode PrepareRptFunctor::VisitLayer(Layer *layer)
 {
+    m_currentMRpt = &m_currentMRpts[{ m_currentStaffN, layer->GetN() }];
+
     // If we have encountered a mRpt before and there is none in this layer, reset it to NULL
-    if (m_currentMRpt && !layer->FindDescendantByType(MRPT)) {
-        m_currentMRpt = NULL;
+    if (*m_currentMRpt && !layer->FindDescendantByType(MRPT)) {
+        *m_currentMRpt = NULL;
     }
     return FUNCTOR_CONTINUE;
 }
 
 FunctorCode PrepareRptFunctor::VisitMRpt(MRpt *mRpt)
 {
-    // If multiNumber is not true, nothing needs to be done
-    if (m_multiNumber != BOOLEAN_true) {
+    // The staff was skipped if multiNumber is not true
+    if (!m_currentMRpt) {
         return FUNCTOR_CONTINUE;
     }
 
     // If this is the first one, number has to be 2
-    if (m_currentMRpt == NULL) {
+    if (*m_currentMRpt == NULL) {
         mRpt->m_drawingMeasureCount = 2;
     }
     // Otherwise increment it
     else {
-        mRpt->m_drawingMeasureCount = m_currentMRpt->m_drawingMeasureCount + 1;
+        mRpt->m_drawingMeasureCount = (*m_currentMRpt)->m_drawingMeasureCount + 1;
     }
-    m_currentMRpt = mRpt;
+    *m_currentMRpt = mRpt;
     return FUNCTOR_CONTINUE;
 }
 
 FunctorCode PrepareRptFunctor::VisitStaff(Staff *staff)
 {
-    // If multiNumber is set, we already know that nothing needs to be done
-    // Furthermore, if @multi.number is false, the functor should have stopped (see below)
-    if (m_multiNumber != BOOLEAN_NONE) {
-        return FUNCTOR_CONTINUE;
+    m_currentStaffN = staff->GetN();
+    m_currentMRpt = NULL;
+
+    data_BOOLEAN &multiNumber = m_multiNumbers[m_currentStaffN];
+    // If multiNumber is set, we already know if something needs to be done for this staff @n
+    if (multiNumber != BOOLEAN_NONE) {
+        return (multiNumber == BOOLEAN_true) ? FUNCTOR_CONTINUE : FUNCTOR_SIBLINGS;
     }
 
     // This is happening only for the first staff element of the staff @n
@@ -1433,12 +1491,12 @@ FunctorCode PrepareRptFunctor::VisitStaff(Staff *staff)
         const bool hideNumber = (staffDef->GetMultiNumber() == BOOLEAN_false)
             || ((staffDef->GetMultiNumber() != BOOLEAN_true) && (scoreDef->GetMultiNumber() == BOOLEAN_false));
         if (hideNumber) {
-            // Set it just in case, but stopping the functor should do it for this staff @n
-            m_multiNumber = BOOLEAN_false;
-            return FUNCTOR_STOP;
+            // Nothing to do for all the staff elements of the staff @n
+            multiNumber = BOOLEAN_false;
+            return FUNCTOR_SIBLINGS;
         }
     }
-    m_multiNumber = BOOLEAN_true;
+    multiNumber = BOOLEAN_true;
     return FUNCTOR_CONTINUE;
 }
 
@@ -1448,14 +1506,26 @@ FunctorCode PrepareRptFunctor::VisitStaff(Staff *staff)
 
 PrepareDelayedTurnsFunctor::PrepareDelayedTurnsFunctor() : Functor(), CollectAndProcess()
 {
-    this->ResetCurrent();
+    m_currentState = NULL;
+}
+
+FunctorCode PrepareDelayedTurnsFunctor::VisitLayer(Layer *layer)
+{
+    // We are initializing the m_delayedTurns map
+    if (this->IsCollectingData()) return FUNCTOR_CONTINUE;
+
+    Staff *staff = vrv_cast<Staff *>(layer->GetFirstAncestor(STAFF));
+    assert(staff);
+    m_currentState = &m_layerStates[{ staff->GetN(), layer->GetN() }];
+
+    return FUNCTOR_CONTINUE;
 }
 
-void PrepareDelayedTurnsFunctor::ResetCurrent()
+FunctorCode PrepareDelayedTurnsFunctor::VisitLayerEnd(Layer *layer)
 {
-    m_previousElement = NULL;
-    m_currentChord = NULL;
-    m_currentTurn = NULL;
+    m_currentState = NULL;
+
+    return FUNCTOR_CONTINUE;
 }
 
 FunctorCode PrepareDelayedTurnsFunctor::VisitLayerElement(LayerElement *layerElement)
@@ -1463,28 +1533,29 @@ FunctorCode PrepareDelayedTurnsFunctor::VisitLayerElement(LayerElement *layerEle
     // We are initializing the m_delayedTurns map
     if (this->IsCollectingData()) return FUNCTOR_CONTINUE;
 
-    if (!layerElement->HasInterface(INTERFACE_DURATION)) return FUNCTOR_CONTINUE;
+    if (!layerElement->HasInterface(INTERFACE_DURATION) || !m_currentState) return FUNCTOR_CONTINUE;
 
-    if (m_previousElement) {
-        assert(m_currentTurn);
-        if (layerElement->Is(NOTE) && m_currentChord) {
+    LayerState &state = *m_currentState;
+    if (state.previousElement) {
+        assert(state.currentTurn);
+        if (layerElement->Is(NOTE) && state.currentChord) {
             Note *note = vrv_cast<Note *>(layerElement);
-            if (note->IsChordTone() == m_currentChord) return FUNCTOR_CONTINUE;
+            if (note->IsChordTone() == state.currentChord) return FUNCTOR_CONTINUE;
         }
-        m_currentTurn->m_drawingEndElement = layerElement;
-        this->ResetCurrent();
+        state.currentTurn->m_drawingEndElement = layerElement;
+        state = LayerState();
     }
 
     if (m_delayedTurns.contains(layerElement)) {
-        m_previousElement = layerElement;
-        m_currentTurn = m_delayedTurns.at(layerElement);
+        state.previousElement = layerElement;
+        state.currentTurn = m_delayedTurns.at(layerElement);
         if (layerElement->Is(CHORD)) {
             return FUNCTOR_SIBLINGS;
         }
         else if (layerElement->Is(NOTE)) {
             Note *note = vrv_cast<Note *>(layerElement);
             Chord *chord = note->IsChordTone();
-            if (chord) m_currentChord = chord;
+            if (chord) state.currentChord = chord;
         }
     }
 
@@ -1596,6 +1667,8 @@ FunctorCode PrepareMilestonesFunctor::VisitSystemMilestone(SystemMilestoneEnd *s
 PrepareFloatingGrpsFunctor::PrepareFloatingGrpsFunctor()
 {
     m_previousEnding = NULL;
+
+    this->SetClassIds({ DIR, DYNAM, ENDING, HAIRPIN, HARM, MEASURE, PEDAL, SYSTEM_MILESTONE_END });
 }
 
 FunctorCode PrepareFloatingGrpsFunctor::VisitDir(Dir *dir)
@@ -1878,7 +1951,10 @@ FunctorCode PrepareStaffCurrentTimeSpanningFunctor::VisitSyl(Syl *syl)
 // PrepareRehPositionFunctor
 //----------------------------------------------------------------------------
 
-PrepareRehPositionFunctor::PrepareRehPositionFunctor() : Functor() {}
+PrepareRehPositionFunctor::PrepareRehPositionFunctor() : Functor()
+{
+    this->SetClassIds({ REH });
+}
 
 FunctorCode PrepareRehPositionFunctor::VisitReh(Reh *reh)
 {
@@ -1894,7 +1970,10 @@ FunctorCode PrepareRehPositionFunctor::VisitReh(Reh *reh)
 // PrepareBeamSpanElementsFunctor
 //----------------------------------------------------------------------------
 
-PrepareBeamSpanElementsFunctor::PrepareBeamSpanElementsFunctor() : Functor() {}
+PrepareBeamSpanElementsFunctor::PrepareBeamSpanElementsFunctor() : Functor()
+{
+    this->SetClassIds({ BEAMSPAN });
+}
 
 FunctorCode PrepareBeamSpanElementsFunctor::VisitBeamSpan(BeamSpan *beamSpan)
 {
@@ -12,6 +12,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -37,6 +38,9 @@ namespace vrv {
 thread_local std::string Resources::s_defaultPath = VRV_RESOURCE_DIR;
 const Resources::StyleAttributes Resources::k_defaultStyle{ data_FONTWEIGHT::FONTWEIGHT_normal,
     data_FONTSTYLE::FONTSTYLE_normal };
+std::map<std::string, std::weak_ptr<const Resources::LoadedFont>> Resources::s_sharedFonts;
+std::map<std::string, std::weak_ptr<const Resources::GlyphTable>> Resources::s_sharedTextFonts;
+std::mutex Resources::s_sharedFontsMutex;
 
 //----------------------------------------------------------------------------
 // Function defined in toolkitdef.h
@@ -58,10 +62,33 @@ Resources::Resources()
     m_useLiberation = false;
 }
 
+Resources::Resources(const Resources &resources)
+{
+    *this = resources;
+}
+
+Resources &Resources::operator=(const Resources &resources)
+{
+    if (this != &resources) {
+        m_useLiberation = resources.m_useLiberation;
+        m_path = resources.m_path;
+        m_defaultFontName = resources.m_defaultFontName;
+        m_fallbackFontName = resources.m_fallbackFontName;
+        m_loadedFonts = resources.m_loadedFonts;
+        m_currentFontName = resources.m_currentFontName;
+        m_textFont = resources.m_textFont;
+        m_currentStyle = resources.m_currentStyle;
+        // The cached glyph points to the tables of the copied resources
+        m_cachedGlyph.reset();
+    }
+    return *this;
+}
+
 bool Resources::InitFonts()
 {
     m_cachedGlyph.reset();
     m_loadedFonts.clear();
+    m_textFont.clear();
 
     // Font Bravura first. As it is expected to have always all symbols we build the code -> name table from it
     if (!LoadFont(BRAVURA)) LogError("Bravura font could not be loaded.");
@@ -95,7 +122,7 @@ bool Resources::InitFonts()
     return true;
 }
 
-bool Resources::SetFont(const std::string &fontName)
+bool Resources::SetFont(const std::string &fontName, bool preloadGlyphs)
 {
     m_cachedGlyph.reset();
 
@@ -110,6 +137,11 @@ bool Resources::SetFont(const std::string &fontName)
     m_defaultFontName = IsFontLoaded(fontName) ? fontName : LEIPZIG;
     m_currentFontName = m_defaultFontName;
 
+    if (preloadGlyphs) {
+        this->PreloadGlyphs(m_currentFontName);
+        this->PreloadGlyphs(m_fallbackFontName);
+    }
+
     return true;
 }
 
@@ -172,6 +204,15 @@ bool Resources::SetCurrentFont(const std::string &fontName, bool allowLoading)
     return false;
 }
 
+void Resources::PreloadGlyphs(const std::string &fontName) const
+{
+    if (!IsFontLoaded(fontName)) return;
+
+    for (const auto &[code, glyph] : m_loadedFonts.at(fontName)->GetGlyphTable()) {
+        glyph.GetXMLDocument();
+    }
+}
+
 const Glyph *Resources::GetGlyph(char32_t smuflCode) const
 {
     if (m_cachedGlyph && m_cachedGlyph->first == smuflCode) {
@@ -205,7 +246,12 @@ const Glyph *Resources::GetGlyph(const std::string &smuflName) const
 
 char32_t Resources::GetGlyphCode(const std::string &smuflName) const
 {
-    if (auto glyphNameIter = m_glyphNameTable.find(smuflName); glyphNameIter != m_glyphNameTable.end()) {
+    // The code -> name table is built from Bravura only
+    auto fontIter = m_loadedFonts.find(BRAVURA);
+    if (fontIter == m_loadedFonts.end()) return 0;
+
+    const GlyphNameTable &glyphNameTable = fontIter->second->GetGlyphNameTable();
+    if (auto glyphNameIter = glyphNameTable.find(smuflName); glyphNameIter != glyphNameTable.end()) {
         return glyphNameIter->second;
     }
     return 0;
@@ -213,7 +259,7 @@ char32_t Resources::GetGlyphCode(const std::string &smuflName) const
 
 bool Resources::IsSmuflFallbackNeeded(const std::u32string &text) const
 {
-    if (m_loadedFonts.at(m_currentFontName).isFallback()) {
+    if (m_loadedFonts.at(m_currentFontName)->isFallback()) {
         return false;
     }
     for (char32_t c : text) {
@@ -233,7 +279,7 @@ bool Resources::FontHasGlyphAvailable(const std::string &fontName, char32_t smuf
         return false;
     }
 
-    const GlyphTable &table = m_loadedFonts.at(fontName).GetGlyphTable();
+    const GlyphTable &table = m_loadedFonts.at(fontName)->GetGlyphTable();
     return (table.find(smuflCode) != table.end());
 }
 
@@ -251,8 +297,7 @@ std::string Resources::GetCSSFontFor(const std::string &fontName) const
         return "";
     }
 
-    const LoadedFont &font = m_loadedFonts.at(fontName);
-    return font.GetCSSFont(m_path);
+    return m_loadedFonts.at(fontName)->GetCSSFont(m_path);
 }
 
 std::string Resources::GetCustomFontname(const std::string &filename, const ZipFileReader &zipFile)
@@ -298,7 +343,7 @@ const Glyph *Resources::GetTextGlyph(char32_t code) const
     const StyleAttributes style = m_textFont.contains(m_currentStyle) ? m_currentStyle : k_defaultStyle;
     if (!m_textFont.contains(style)) return NULL;
 
-    const GlyphTable &currentTable = m_textFont.at(style);
+    const GlyphTable &currentTable = *m_textFont.at(style);
     if (!currentTable.contains(code)) {
         return NULL;
     }
@@ -320,6 +365,39 @@ char32_t Resources::GetSmuflGlyphForUnicodeChar(const char32_t unicodeChar)
 }
 
 bool Resources::LoadFont(const std::string &fontName, ZipFileReader *zipFile)
+{
+    // Fonts from zip archives are specific to the instance and are not shared
+    std::shared_ptr<const LoadedFont> font
+        = (zipFile) ? ReadFont(m_path, fontName, zipFile) : GetSharedFont(m_path, fontName);
+    if (!font) return false;
+
+    m_loadedFonts[fontName] = font;
+
+    const GlyphTable &glyphTable = font->GetGlyphTable();
+    if (font->isFallback() && glyphTable.size() < SMUFL_COUNT) {
+        LogError("Expected %d default SMuFL glyphs but could load only %d.", SMUFL_COUNT, glyphTable.size());
+        return false;
+    }
+
+    return true;
+}
+
+std::shared_ptr<const Resources::LoadedFont> Resources::GetSharedFont(
+    const std::string &path, const std::string &fontName)
+{
+    const std::string key = path + "/" + fontName;
+    const std::lock_guard<std::mutex> lock(s_sharedFontsMutex);
+
+    std::shared_ptr<const LoadedFont> font = s_sharedFonts[key].lock();
+    if (!font) {
+        font = ReadFont(path, fontName, NULL);
+        if (font) s_sharedFonts[key] = font;
+    }
+    return font;
+}
+
+std::shared_ptr<Resources::LoadedFont> Resources::ReadFont(
+    const std::string &path, const std::string &fontName, ZipFileReader *zipFile)
 {
     pugi::xml_document doc;
     // For zip archive custom font, load the data from the zipFile
@@ -328,43 +406,43 @@ bool Resources::LoadFont(const std::string &fontName, ZipFileReader *zipFile)
         if (!zipFile->HasFile(filename)) {
             // File not found, default bounding boxes will be used
             LogError("Failed to load the XML file containing glyph bounding boxes");
-            return false;
+            return NULL;
         }
         pugi::xml_parse_result parseResult = doc.load_string(zipFile->ReadTextFile(filename).c_str());
         if (!parseResult) {
             // File not found, default bounding boxes will be used
             LogError("Failed to parse the XML file containing glyph bounding boxes");
-            return false;
+            return NULL;
         }
     }
     // Other wise use the resource directory
     else {
-        const std::string filename = Resources::GetPath() + "/" + fontName + ".xml";
+        const std::string filename = path + "/" + fontName + ".xml";
         pugi::xml_parse_result parseResult = doc.load_file(filename.c_str());
         if (!parseResult) {
             // File not found, default bounding boxes will be used
             LogError("Failed to load font and glyph bounding boxes");
-            return false;
+            return NULL;
         }
     }
     pugi::xml_node root = doc.first_child();
     if (!root.attribute("units-per-em")) {
         LogError("No units-per-em attribute in bounding box file");
-        return false;
+        return NULL;
     }
 
     bool buildNameTable = (fontName == BRAVURA) ? true : false;
     bool isFallback = ((fontName == BRAVURA) || (fontName == LEIPZIG)) ? true : false;
 
-    m_loadedFonts.insert(std::pair<std::string, LoadedFont>(fontName, Resources::LoadedFont(fontName, isFallback)));
-    LoadedFont &font = m_loadedFonts.at(fontName);
+    std::shared_ptr<LoadedFont> font = std::make_shared<LoadedFont>(fontName, isFallback);
 
     // For zip archive custom font also store the CSS
     if (zipFile) {
-        font.SetCSSFont(zipFile->ReadTextFile(fontName + ".css"));
+        font->SetCSSFont(zipFile->ReadTextFile(fontName + ".css"));
     }
 
-    GlyphTable &glyphTable = font.GetGlyphTableForModification();
+    GlyphTable &glyphTable = font->GetGlyphTableForModification();
+    GlyphNameTable &glyphNameTable = font->GetGlyphNameTableForModification();
 
     const int unitsPerEm = atoi(root.attribute("units-per-em").value());
 
@@ -390,7 +468,7 @@ bool Resources::LoadFont(const std::string &fontName, ZipFileReader *zipFile)
         }
         // Otherwise only store the path
         else {
-            glyph.SetPath(Resources::GetPath() + "/" + glyphFilename);
+            glyph.SetPath(path + "/" + glyphFilename);
         }
 
         if (current.attribute("h-a-x")) glyph.SetHorizAdvX(current.attribute("h-a-x").as_float());
@@ -409,42 +487,58 @@ bool Resources::LoadFont(const std::string &fontName, ZipFileReader *zipFile)
         const char32_t smuflCode = (char32_t)strtol(c_attribute.value(), NULL, 16);
         glyphTable[smuflCode] = glyph;
         if (buildNameTable) {
-            m_glyphNameTable[n_attribute.value()] = smuflCode;
+            glyphNameTable[n_attribute.value()] = smuflCode;
         }
     }
 
-    if (isFallback && glyphTable.size() < SMUFL_COUNT) {
-        LogError("Expected %d default SMuFL glyphs but could load only %d.", SMUFL_COUNT, glyphTable.size());
-        return false;
-    }
+    return font;
+}
+
+bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes &style)
+{
+    std::shared_ptr<const GlyphTable> textFont = GetSharedTextFont(m_path, fontName);
+    if (!textFont) return false;
 
+    m_textFont[style] = textFont;
     return true;
 }
 
-bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes &style)
+std::shared_ptr<const Resources::GlyphTable> Resources::GetSharedTextFont(
+    const std::string &path, const std::string &fontName)
+{
+    const std::string key = path + "/text/" + fontName;
+    const std::lock_guard<std::mutex> lock(s_sharedFontsMutex);
+
+    std::shared_ptr<const GlyphTable> textFont = s_sharedTextFonts[key].lock();
+    if (!textFont) {
+        textFont = ReadTextFont(path, fontName);
+        if (textFont) s_sharedTextFonts[key] = textFont;
+    }
+    return textFont;
+}
+
+std::shared_ptr<Resources::GlyphTable> Resources::ReadTextFont(const std::string &path, const std::string &fontName)
 {
     // For the text font, we load the bounding boxes only
     pugi::xml_document doc;
     // For now, we have only Times bounding boxes for ASCII chars
     // For any other char, we currently use 'o' bounding box
-    std::string filename = GetPath() + "/text/" + fontName + ".xml";
+    std::string filename = path + "/text/" + fontName + ".xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
         LogInfo("Cannot load bounding boxes for text font '%s'", filename.c_str());
-        return false;
+        return NULL;
     }
     pugi::xml_node root = doc.first_child();
     if (!root.attribute("units-per-em")) {
         LogWarning("No units-per-em attribute in bounding box file");
-        return false;
+        return NULL;
     }
     const int unitsPerEm = root.attribute("units-per-em").as_int();
     pugi::xml_node current;
-    if (!m_textFont.contains(style)) {
-        m_textFont[style] = {};
-    }
-    GlyphTable &currentTable = m_textFont.at(style);
+    std::shared_ptr<GlyphTable> textFont = std::make_shared<GlyphTable>();
+    GlyphTable &currentTable = *textFont;
     for (current = root.child("g"); current; current = current.next_sibling("g")) {
         if (current.attribute("c")) {
             char32_t code = (char32_t)strtol(current.attribute("c").value(), NULL, 16);
@@ -466,7 +560,7 @@ bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes
             currentTable[code] = glyph;
         }
     }
-    return true;
+    return textFont;
 }
 
 std::string Resources::LoadedFont::GetCSSFont(const std::string &path) const
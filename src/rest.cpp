@@ -247,6 +247,7 @@ bool Rest::AddChild(Object *child)
     else {
         children.push_back(child);
     }
+    this->IndexChild(child);
     this->Modify();
 
     return true;
@@ -55,6 +55,23 @@ Score::Score(bool createScoreDef) : PageElement(SCORE), PageMilestoneInterface()
     this->Reset();
 }
 
+Score::Score(const Score &score)
+    : PageElement(score), PageMilestoneInterface(score), AttLabelled(score), AttNNumberLike(score)
+{
+    m_scoreDef = NULL;
+    m_scoreDefSubtree = NULL;
+
+    // The subtree is not a child and needs to be copied explicitly
+    if (score.m_scoreDefSubtree) {
+        m_scoreDefSubtree = score.m_scoreDefSubtree->Clone();
+        m_scoreDefSubtree->CloneReset();
+        // Select the scoreDef in the copied subtree as it is done when reading the score
+        m_scoreDef = (m_scoreDefSubtree->Is(SCOREDEF))
+            ? vrv_cast<ScoreDef *>(m_scoreDefSubtree)
+            : vrv_cast<ScoreDef *>(m_scoreDefSubtree->FindDescendantByType(SCOREDEF));
+    }
+}
+
 Score::~Score()
 {
     if (m_scoreDefSubtree) {
@@ -223,8 +223,18 @@ SpannedElements Slur::CollectSpannedElements(const Staff *staff, int xMin, int x
     }
     findSpannedLayerElements.SetStaffNs(staffNumbers);
 
+    // Search in the layer element index of the system if available since this avoids a traversal of the container
+    const System *system = vrv_cast<const System *>(staff->GetFirstAncestor(SYSTEM));
+    assert(system);
+    const LayerElementIndex *index = system->GetLayerElementIndex();
+    auto runSearch = [container, index, &findSpannedLayerElements]() {
+        if (!index || !findSpannedLayerElements.ProcessIndex(*index, container)) {
+            container->Process(findSpannedLayerElements);
+        }
+    };
+
     // Run the search without layer bounds
-    container->Process(findSpannedLayerElements);
+    runSearch();
 
     // Now determine the minimal and maximal layer
     std::set<int> layersN;
@@ -300,7 +310,7 @@ SpannedElements Slur::CollectSpannedElements(const Staff *staff, int xMin, int x
         if (layersAreSeparated || this->HasLayer()) {
             findSpannedLayerElements.ClearElements();
             findSpannedLayerElements.SetMinMaxLayerN(minLayerN, maxLayerN);
-            container->Process(findSpannedLayerElements);
+            runSearch();
             spannedElements = findSpannedLayerElements.GetElements();
         }
     }
@@ -31,6 +31,9 @@ namespace vrv {
 #define space " "
 #define semicolon ";"
 
+// The prefix of the comments used as placeholders for the streamed graphics
+#define STREAM_PLACEHOLDER "vrv-stream-"
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
@@ -55,6 +58,7 @@ SvgDeviceContext::SvgDeviceContext(const std::string &docId) : DeviceContext(SVG
     m_html5 = false;
     m_formatRaw = false;
     m_removeXlink = false;
+    m_stream = false;
     m_facsimile = false;
     m_useLiberation = false;
     m_indent = 2;
@@ -204,19 +208,18 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     if (m_smuflGlyphs.size() > 0) {
 
         pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
 
         // for each needed glyph
         for (const auto &entry : m_smuflGlyphs) {
             const Glyph *glyph = entry.first;
             const SvgDeviceContext::GlyphRef &ref = entry.second;
-            // load the XML as a pugi::xml_document
-            sourceDoc.load_string(glyph->GetXML().c_str());
+            // get the XML as a pugi::xml_document - it is parsed only once and kept in the glyph
+            const pugi::xml_document *sourceDoc = glyph->GetXMLDocument();
 
             // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
-                child.attribute("id").set_value(ref.GetRefId().c_str());
-                defs.append_copy(child);
+            for (pugi::xml_node child = sourceDoc->first_child(); child; child = child.next_sibling()) {
+                pugi::xml_node def = defs.append_copy(child);
+                def.attribute("id").set_value(ref.GetRefId().c_str());
             }
         }
     }
@@ -241,7 +244,12 @@ void SvgDeviceContext::Commit(bool xml_declaration)
 
     // save the glyph data to m_outdata
     std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
-    m_svgDoc.save(m_outdata, indent.c_str(), output_flags);
+    if (m_streamedGraphics.empty()) {
+        m_svgDoc.save(m_outdata, indent.c_str(), output_flags);
+    }
+    else {
+        this->SaveStreamedSVG(indent, output_flags);
+    }
 
     m_committed = true;
 }
@@ -429,14 +437,19 @@ void SvgDeviceContext::ResumeGraphic(Object *object, std::string gId)
 void SvgDeviceContext::EndGraphic(Object *object, View *view)
 {
     this->DrawSvgBoundingBox(object, view);
+    pugi::xml_node node = m_svgNodeStack.back();
     m_svgNodeStack.pop_back();
     m_currentNode = m_svgNodeStack.back();
+    // Graphics are resumed only within a system, so the ones in the page can be written
+    if (m_stream && (node.parent() == m_pageNode)) this->StreamGraphic(node);
 }
 
 void SvgDeviceContext::EndCustomGraphic()
 {
+    pugi::xml_node node = m_svgNodeStack.back();
     m_svgNodeStack.pop_back();
     m_currentNode = m_svgNodeStack.back();
+    if (m_stream && (node.parent() == m_pageNode)) this->StreamGraphic(node);
 }
 
 void SvgDeviceContext::SetCustomGraphicColor(const std::string &color)
@@ -1286,6 +1299,56 @@ std::string SvgDeviceContext::GetColor(int color) const
     }
 }
 
+void SvgDeviceContext::StreamGraphic(pugi::xml_node node)
+{
+    std::string indent;
+    unsigned int depth = 0;
+    unsigned int flags = pugi::format_default;
+    if (m_formatRaw) {
+        flags |= pugi::format_raw;
+    }
+    else {
+        indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+        for (pugi::xml_node parent = node.parent(); parent != m_svgDoc; parent = parent.parent()) ++depth;
+    }
+
+    std::ostringstream graphic;
+    node.print(graphic, indent.c_str(), flags, pugi::encoding_auto, depth);
+    std::string graphicStr = graphic.str();
+    // Remove the indentation and the newline since the placeholder has them already
+    if (!m_formatRaw) {
+        graphicStr.erase(0, indent.size() * depth);
+        if (!graphicStr.empty() && (graphicStr.back() == '\n')) graphicStr.pop_back();
+    }
+
+    pugi::xml_node placeholder = node.parent().insert_child_before(pugi::node_comment, node);
+    placeholder.set_value(StringFormat(STREAM_PLACEHOLDER "%d", (int)m_streamedGraphics.size()).c_str());
+    node.parent().remove_child(node);
+
+    m_streamedGraphics.push_back(std::move(graphicStr));
+}
+
+void SvgDeviceContext::SaveStreamedSVG(const std::string &indent, unsigned int flags)
+{
+    std::ostringstream svg;
+    m_svgDoc.save(svg, indent.c_str(), flags);
+    const std::string svgStr = svg.str();
+
+    const std::string prefix = "<!--" STREAM_PLACEHOLDER;
+    size_t pos = 0;
+    size_t found;
+    while ((found = svgStr.find(prefix, pos)) != std::string::npos) {
+        const size_t end = svgStr.find("-->", found);
+        assert(end != std::string::npos);
+        const int idx = atoi(svgStr.c_str() + found + prefix.size());
+        assert((idx >= 0) && (idx < (int)m_streamedGraphics.size()));
+        m_outdata.write(svgStr.data() + pos, found - pos);
+        m_outdata << m_streamedGraphics.at(idx);
+        pos = end + 3;
+    }
+    m_outdata.write(svgStr.data() + pos, svgStr.size() - pos);
+}
+
 std::string SvgDeviceContext::GetStringSVG(bool xml_declaration)
 {
     if (!m_committed) Commit(xml_declaration);
@@ -54,6 +54,7 @@ System::System() : Object(SYSTEM), DrawingListInterface(), AttTyped()
 
     // owned pointers need to be set to NULL;
     m_drawingScoreDef = NULL;
+    m_layerElementIndex = NULL;
 
     this->Reset();
 }
@@ -71,6 +72,7 @@ void System::Reset()
     this->ResetTyped();
 
     this->ResetDrawingScoreDef();
+    this->ClearLayerElementIndex();
 
     m_systemLeftMar = 0;
     m_systemRightMar = 0;
@@ -229,6 +231,23 @@ void System::ResetDrawingScoreDef()
     }
 }
 
+void System::BuildLayerElementIndex()
+{
+    this->ClearLayerElementIndex();
+
+    m_layerElementIndex = new LayerElementIndex();
+    CollectLayerElementIndexFunctor collectLayerElementIndex(m_layerElementIndex);
+    this->Process(collectLayerElementIndex);
+}
+
+void System::ClearLayerElementIndex()
+{
+    if (m_layerElementIndex) {
+        delete m_layerElementIndex;
+        m_layerElementIndex = NULL;
+    }
+}
+
 bool System::HasMixedDrawingStemDir(const LayerElement *start, const LayerElement *end) const
 {
     assert(start);
@@ -77,6 +77,11 @@ void SystemMilestoneInterface::ConvertToPageBasedMilestone(Object *object, Objec
     object->ClearRelinquishedChildren();
 }
 
+void SystemMilestoneInterface::ConvertToScoreBasedContainer()
+{
+    m_end = NULL;
+}
+
 //----------------------------------------------------------------------------
 // SystemMilestoneEnd functor methods
 //----------------------------------------------------------------------------
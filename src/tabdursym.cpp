@@ -83,6 +83,7 @@ bool TabDurSym::AddChild(Object *child)
     else {
         children.push_back(child);
     }
+    this->IndexChild(child);
     this->Modify();
 
     return true;
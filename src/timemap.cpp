@@ -9,10 +9,17 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
+#include <climits>
+#include <cmath>
+#include <tuple>
 
 //----------------------------------------------------------------------------
 
+#include "chord.h"
+#include "comparison.h"
+#include "doc.h"
 #include "jsonxx.h"
 #include "measure.h"
 #include "note.h"
@@ -107,4 +114,199 @@ jsonxx::Array Timemap::ToArray(const Fraction &fraction)
     return array;
 }
 
+//----------------------------------------------------------------------------
+// TimemapIndex
+//----------------------------------------------------------------------------
+
+TimemapIndex::TimemapIndex()
+{
+    this->Reset();
+}
+
+TimemapIndex::~TimemapIndex() {}
+
+void TimemapIndex::Reset()
+{
+    m_measures.clear();
+    m_notes.clear();
+    m_measureTree = IntervalTree();
+    m_noteTree = IntervalTree();
+    m_isBuilt = false;
+}
+
+void TimemapIndex::Build(Doc *doc)
+{
+    assert(doc);
+
+    this->Reset();
+
+    ListOfObjects measures = doc->FindAllDescendantsByType(MEASURE);
+    for (Object *object : measures) {
+        Measure *measure = vrv_cast<Measure *>(object);
+        assert(measure);
+        const int measureIdx = (int)m_measures.size();
+        MeasureItem &measureItem = m_measures.emplace_back();
+        measureItem.id = measure->GetID();
+
+        ListOfObjects notesOrRests;
+        ClassIdsComparison notesOrRestsComparison({ NOTE, REST });
+        measure->FindAllDescendantsByComparison(&notesOrRests, &notesOrRestsComparison);
+        ListOfObjects mRests;
+        ClassIdsComparison mRestComparison({ MULTIREST, MREST });
+        measure->FindAllDescendantsByComparison(&mRests, &mRestComparison);
+        for (Object *mRest : mRests) {
+            measureItem.mRests.push_back(mRest->GetID());
+        }
+
+        const int firstNoteIdx = (int)m_notes.size();
+        for (Object *noteOrRest : notesOrRests) {
+            NoteItem &noteItem = m_notes.emplace_back();
+            noteItem.id = noteOrRest->GetID();
+            noteItem.isRest = noteOrRest->Is(REST);
+            noteItem.measure = measureIdx;
+            if (noteOrRest->Is(NOTE)) {
+                Note *note = vrv_cast<Note *>(noteOrRest);
+                assert(note);
+                Chord *chord = note->IsChordTone();
+                if (chord) noteItem.chord = chord->GetID();
+            }
+        }
+
+        // The bounds are rounded as with the integer time given to Measure::EnclosesTime
+        const double duration = measure->GetRealTimeDurationMilliseconds();
+        for (int repeat = 1; repeat <= measure->GetRepeatCount(); ++repeat) {
+            const double onset = measure->GetRealTimeOnsetMilliseconds(repeat);
+            m_measureTree.intervals.push_back(
+                { (int)std::ceil(onset), (int)std::floor(onset + duration), measureIdx, repeat });
+            // Note and rest times are relative to the measure onset truncated to milliseconds
+            const int measureOffset = onset;
+            int noteIdx = firstNoteIdx;
+            for (Object *noteOrRest : notesOrRests) {
+                const DurationInterface *interface = noteOrRest->GetDurationInterface();
+                assert(interface);
+                const int noteOnset = (int)std::ceil(interface->GetRealTimeOnsetMilliseconds()) + measureOffset;
+                const int noteOffset = (int)std::floor(interface->GetRealTimeOffsetMilliseconds()) + measureOffset;
+                m_noteTree.intervals.push_back({ noteOnset, noteOffset, noteIdx, repeat });
+                ++noteIdx;
+            }
+        }
+    }
+
+    m_measureTree.Build();
+    m_noteTree.Build();
+    m_isBuilt = true;
+}
+
+bool TimemapIndex::GetElementsAtTime(int time, TimemapElements &elements) const
+{
+    elements = TimemapElements();
+
+    std::vector<const Interval *> overlapping;
+    m_measureTree.FindOverlapping(time, time, overlapping);
+    if (overlapping.empty()) return false;
+
+    // Take the first measure in document order (and its first repeat) as a traversal would do
+    const Interval *measure
+        = *std::min_element(overlapping.begin(), overlapping.end(), [](const Interval *a, const Interval *b) {
+              return std::tie(a->item, a->repeat) < std::tie(b->item, b->repeat);
+          });
+    const MeasureItem &measureItem = m_measures.at(measure->item);
+    elements.measure = measureItem.id;
+
+    overlapping.clear();
+    m_noteTree.FindOverlapping(time, time, overlapping);
+    std::erase_if(overlapping, [this, measure](const Interval *interval) {
+        return (m_notes.at(interval->item).measure != measure->item) || (interval->repeat != measure->repeat);
+    });
+    std::sort(overlapping.begin(), overlapping.end(),
+        [](const Interval *a, const Interval *b) { return (a->item < b->item); });
+
+    for (const Interval *interval : overlapping) {
+        const NoteItem &noteItem = m_notes.at(interval->item);
+        if (noteItem.isRest) {
+            elements.rests.push_back(noteItem.id);
+            continue;
+        }
+        elements.notes.push_back(noteItem.id);
+        if (!noteItem.chord.empty() && (elements.chords.empty() || (elements.chords.back() != noteItem.chord))) {
+            elements.chords.push_back(noteItem.chord);
+        }
+    }
+    elements.rests.insert(elements.rests.end(), measureItem.mRests.begin(), measureItem.mRests.end());
+
+    return true;
+}
+
+std::vector<int> TimemapIndex::GetChangeTimes(int start, int end) const
+{
+    // The elements being played can only change at the onset or right after the offset of an interval
+    std::vector<const Interval *> overlapping;
+    m_measureTree.FindOverlapping(start, end, overlapping);
+    m_noteTree.FindOverlapping(start, end, overlapping);
+
+    std::vector<int> candidates = { start };
+    for (const Interval *interval : overlapping) {
+        if (interval->onset > start) candidates.push_back(interval->onset);
+        if (interval->offset < end) candidates.push_back(interval->offset + 1);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    // Keep only the times at which the elements actually change
+    std::vector<int> times;
+    TimemapElements previous;
+    TimemapElements current;
+    for (int time : candidates) {
+        this->GetElementsAtTime(time, current);
+        if (times.empty() || !(current == previous)) {
+            times.push_back(time);
+            previous = current;
+        }
+    }
+
+    return times;
+}
+
+//----------------------------------------------------------------------------
+// TimemapIndex::IntervalTree
+//----------------------------------------------------------------------------
+
+void TimemapIndex::IntervalTree::Build()
+{
+    std::sort(intervals.begin(), intervals.end(),
+        [](const Interval &a, const Interval &b) { return (a.onset < b.onset); });
+    maxOffsets.resize(intervals.size());
+    this->FillMaxOffsets(0, (int)intervals.size());
+}
+
+int TimemapIndex::IntervalTree::FillMaxOffsets(int low, int high)
+{
+    // The node of the range [low, high) is its middle interval
+    if (low >= high) return INT_MIN;
+    const int middle = low + (high - low) / 2;
+    maxOffsets.at(middle) = std::max(
+        { intervals.at(middle).offset, this->FillMaxOffsets(low, middle), this->FillMaxOffsets(middle + 1, high) });
+    return maxOffsets.at(middle);
+}
+
+void TimemapIndex::IntervalTree::FindOverlapping(
+    int start, int end, std::vector<const Interval *> &overlapping) const
+{
+    this->FindOverlapping(0, (int)intervals.size(), start, end, overlapping);
+}
+
+void TimemapIndex::IntervalTree::FindOverlapping(
+    int low, int high, int start, int end, std::vector<const Interval *> &overlapping) const
+{
+    if (low >= high) return;
+    const int middle = low + (high - low) / 2;
+    // Nothing in the subtree ends after the start
+    if (maxOffsets.at(middle) < start) return;
+    this->FindOverlapping(low, middle, start, end, overlapping);
+    // Everything on the right starts after the end
+    if (intervals.at(middle).onset > end) return;
+    if (intervals.at(middle).offset >= start) overlapping.push_back(&intervals.at(middle));
+    this->FindOverlapping(middle + 1, high, start, end, overlapping);
+}
+
 } // namespace vrv
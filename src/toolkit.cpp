@@ -9,9 +9,12 @@
 
 //----------------------------------------------------------------------------
 
+#include <atomic>
 #include <cassert>
+#include <cmath>
 #include <locale>
 #include <regex>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
@@ -37,6 +40,7 @@
 #include "note.h"
 #include "options.h"
 #include "page.h"
+#include "runningelement.h"
 #include "runtimeclock.h"
 #include "score.h"
 #include "slur.h"
@@ -66,6 +70,7 @@ char *Toolkit::m_humdrumBuffer = NULL;
 Toolkit::Toolkit(bool initFont)
 {
     m_midiDoc = NULL;
+    m_castOffBreaks = BREAKS_none;
 
     m_humdrumBuffer = NULL;
     m_cString = NULL;
@@ -125,7 +130,7 @@ bool Toolkit::SetResourcePath(const std::string &path)
     if (m_options->m_fontAddCustom.IsSet()) {
         success = success && resources.AddCustom(m_options->m_fontAddCustom.GetValue());
     }
-    if (m_options->m_font.IsSet()) {
+    if (m_options->m_font.IsSet() || m_options->m_fontPreload.GetValue()) {
         success = success && this->SetFont(m_options->m_font.GetValue());
     }
     if (m_options->m_fontFallback.IsSet()) {
@@ -145,6 +150,10 @@ bool Toolkit::SetFont(const std::string &fontName)
     Resources &resources = m_doc.GetResourcesForModification();
     const bool ok = resources.SetCurrentFont(fontName, true);
     if (!ok) LogWarning("Font '%s' could not be loaded", fontName.c_str());
+    if (ok && m_options->m_fontPreload.GetValue()) {
+        resources.PreloadGlyphs(fontName);
+        resources.PreloadGlyphs(resources.GetFallbackFont());
+    }
     return ok;
 }
 
@@ -179,6 +188,9 @@ FileFormat Toolkit::IdentifyInputFrom(const std::string &data)
     if (data.empty()) {
         return UNKNOWN;
     }
+    if (MEIBinaryCodec::IsBinary(data)) {
+        return SERIALIZATION;
+    }
     if (data[0] == 0) {
         return UNKNOWN;
     }
@@ -274,15 +286,100 @@ void Toolkit::SetMidiDoc()
         m_midiDoc = new Doc();
         m_midiDoc->SetOptions(m_doc.GetOptions());
         m_midiDoc->GetOptions()->m_expandAlways.SetValue(true);
-        Resources &resources = m_midiDoc->GetResourcesForModification();
-        resources.SetPath(m_doc.GetResources().GetPath());
-        resources.InitFonts();
-        MEIInput midiInput(m_midiDoc);
-        midiInput.Import(this->GetMEI());
+        // The fonts do not change and do not need to be loaded again
+        m_midiDoc->GetResourcesForModification() = m_doc.GetResources();
+
+        int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+        const bool hadSelection = m_doc.HasSelection();
+        if (hadSelection) m_doc.DeactiveateSelection();
+
+        // Copy the content as score-based tree to expand it as it would be when loading MEI
+        m_doc.CopyToScoreBasedDoc(m_midiDoc);
+
+        if (hadSelection) m_doc.ReactivateSelection(false);
+        if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+
+        m_midiDoc->ExpandExpansions();
+        m_midiDoc->ConvertToPageBasedDoc();
         m_midiDoc->PrepareData();
     }
 }
 
+bool Toolkit::CanRenderConcurrently()
+{
+    // The layout is not (only) the result of the cast-off
+    if (m_castOffBreaks == BREAKS_none) return false;
+    if (m_doc.IsFacs() || m_doc.IsTranscription() || m_doc.IsMensuralMusicOnly() || m_doc.HasSelection()) {
+        return false;
+    }
+
+    // Text divs and encoded running elements are not copied
+    if (m_doc.FindDescendantByType(DIV)) return false;
+    ClassIdsComparison matchType({ PGHEAD, PGFOOT });
+    for (Score *score : m_doc.GetVisibleScores()) {
+        ListOfConstObjects runningElements;
+        score->GetScoreDef()->FindAllDescendantsByComparison(&runningElements, &matchType);
+        for (const Object *object : runningElements) {
+            if (!vrv_cast<const RunningElement *>(object)->IsGenerated()) return false;
+        }
+    }
+
+    return true;
+}
+
+void Toolkit::CopyForRendering(Toolkit &target)
+{
+    target.m_doc.SetOptions(m_doc.GetOptions());
+    // The fonts do not change and do not need to be loaded again
+    target.m_doc.GetResourcesForModification() = m_doc.GetResources();
+
+    // Mensural music is not rendered concurrently, so this does not change the drawing page of the doc
+    m_doc.CopyToScoreBasedDoc(&target.m_doc);
+    // The doc ID is used for the glyph definitions in the SVG
+    target.m_doc.SetID(m_doc.GetID());
+}
+
+bool Toolkit::LayOutCopy(const ListOfConstObjects &layoutObjects, int castOffBreaks)
+{
+    m_doc.ConvertToPageBasedDoc();
+
+    // Generated measure numbers are copied but not the page header and footer
+    bool adjustPageHeight = m_options->m_adjustPageHeight.GetValue();
+    int footerOption = m_options->m_footer.GetValue();
+    if ((!adjustPageHeight && (footerOption == FOOTER_auto)) || (footerOption == FOOTER_always)) {
+        m_doc.GenerateFooter();
+    }
+    if (m_options->m_header.GetValue() == HEADER_auto) {
+        m_doc.GenerateHeader();
+    }
+
+    m_doc.PrepareData();
+
+    switch (castOffBreaks) {
+        case BREAKS_encoded: m_doc.CastOffEncodingDoc(); break;
+        case BREAKS_line: m_doc.CastOffLineDoc(); break;
+        case BREAKS_smart: m_doc.CastOffSmartDoc(); break;
+        default: m_doc.CastOffDoc();
+    }
+
+    m_view.SetDoc(&m_doc);
+
+    // Pages and systems are created by the cast-off and get the IDs of the doc they are copied from
+    ClassIdsComparison matchType({ PAGE, SYSTEM });
+    ListOfObjects copiedObjects;
+    m_doc.FindAllDescendantsByComparison(&copiedObjects, &matchType);
+    if (copiedObjects.size() != layoutObjects.size()) return false;
+
+    auto layoutIt = layoutObjects.begin();
+    for (Object *object : copiedObjects) {
+        if (object->GetClassId() != (*layoutIt)->GetClassId()) return false;
+        object->SetID((*layoutIt)->GetID());
+        ++layoutIt;
+    }
+
+    return true;
+}
+
 bool Toolkit::LoadFile(const std::string &filename)
 {
     this->ResetMidiDoc();
@@ -295,7 +392,7 @@ bool Toolkit::LoadFile(const std::string &filename)
         return this->LoadZipFile(filename);
     }
 
-    std::ifstream in(filename.c_str());
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
     if (!in.is_open()) {
         return false;
     }
@@ -308,8 +405,11 @@ bool Toolkit::LoadFile(const std::string &filename)
     // read the file into the std::string:
     std::string content(fileSize, 0);
     in.read(&content[0], fileSize);
+    content.resize(in.gcount());
+    in.close();
 
-    return this->LoadData(content, false);
+    // The content is ours and can be parsed in place without another copy
+    return this->LoadData(std::move(content), false);
 }
 
 bool Toolkit::IsUTF16(const std::string &filename)
@@ -370,7 +470,7 @@ bool Toolkit::LoadUTF16File(const std::string &filename)
     // std::wstring_convert<std::codecvt_utf8<char16_t>, char16_t> convert;
     std::string utf8line = vrv::UTF16to8(u16data); // convert.to_bytes(u16data);
 
-    return this->LoadData(utf8line, false);
+    return this->LoadData(std::move(utf8line), false);
 }
 
 std::string UTF16toUTF8(const std::u16string &input)
@@ -408,25 +508,19 @@ bool Toolkit::IsZip(const std::string &filename)
 
 bool Toolkit::LoadZipFile(const std::string &filename)
 {
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
+    this->ResetMidiDoc();
+    this->ResetLogBuffer();
+#ifndef NO_MXL_SUPPORT
+    // Read the archive directly instead of going through an intermediate byte vector
+    ZipFileReader zipFileReader;
+    if (!zipFileReader.Load(filename)) {
         return false;
     }
-
-    fin.seekg(0, std::ios::end);
-    std::streamsize fileSize = (std::streamsize)fin.tellg();
-    fin.clear();
-    fin.seekg(0, std::wios::beg);
-
-    std::vector<unsigned char> bytes;
-    bytes.reserve(fileSize + 1);
-
-    unsigned char buffer;
-    while (fin.read((char *)&buffer, sizeof(unsigned char))) {
-        bytes.push_back(buffer);
-    }
-
-    return this->LoadZipData(bytes);
+    return this->LoadZipArchive(zipFileReader);
+#else
+    LogError("MXL import is not supported in this build.");
+    return false;
+#endif
 }
 
 bool Toolkit::LoadZipData(const std::vector<unsigned char> &bytes)
@@ -436,7 +530,16 @@ bool Toolkit::LoadZipData(const std::vector<unsigned char> &bytes)
 #ifndef NO_MXL_SUPPORT
     ZipFileReader zipFileReader;
     zipFileReader.LoadBytes(bytes);
+    return this->LoadZipArchive(zipFileReader);
+#else
+    LogError("MXL import is not supported in this build.");
+    return false;
+#endif
+}
 
+bool Toolkit::LoadZipArchive(ZipFileReader &zipFileReader)
+{
+#ifndef NO_MXL_SUPPORT
     const std::string metaInf = "META-INF/container.xml";
     if (!zipFileReader.HasFile(metaInf)) {
         LogError("No '%s' file to load found in the archive", metaInf.c_str());
@@ -502,6 +605,20 @@ void Toolkit::SetViewAndEditor()
 
 bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
 {
+    return this->LoadData(data, resetLogBuffer, NULL);
+}
+
+bool Toolkit::LoadData(std::string &&data, bool resetLogBuffer)
+{
+    return this->LoadData(data, resetLogBuffer, &data);
+}
+
+bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer, std::string *buffer)
+{
+    assert(!buffer || (buffer == &data));
+
+    ProfileScope profileScope(m_doc.GetProfiler(), "LoadData");
+
     const Resources &resources = m_doc.GetResources();
     if (!resources.Ok()) {
         LogError("The data cannot be loaded because the font resources are not available");
@@ -510,8 +627,11 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
 
     std::string newData;
     Input *input = NULL;
+    // Set when the input already imported the data into m_doc (e.g. Humdrum-based conversions)
+    bool isImported = false;
 
     this->ResetMidiDoc();
+    m_castOffBreaks = BREAKS_none;
     if (resetLogBuffer) {
         this->ResetLogBuffer();
     }
@@ -591,6 +711,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
 
         // Read embedded options from input Humdrum file:
         ((HumdrumInput *)input)->parseEmbeddedOptions(&m_doc);
+        isImported = true;
     }
     else if (inputFrom == HUMMEI) {
         // convert first to MEI and then load MEI data via MEIInput.  This
@@ -661,40 +782,27 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         std::string buffer = conversion.str();
         this->SetHumdrumBuffer(buffer.c_str());
 
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion.str())) {
+        // Now import the Humdrum data directly into the document:
+        input = new HumdrumInput(&m_doc);
+        if (!input->Import(buffer)) {
             LogError("Error importing Humdrum data (2)");
-            delete tempinput;
+            delete input;
             return false;
         }
-        MEIOutput meioutput(&tempdoc);
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.Export();
-        delete tempinput;
-        input = new MEIInput(&m_doc);
+        isImported = true;
     }
 
     else if (inputFrom == MEIHUM) {
         this->ConvertMEIToHumdrum(data);
 
-        // Now convert Humdrum into MEI:
-        std::string conversion = this->GetHumdrumBuffer();
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion)) {
+        // Now import the Humdrum data directly into the document:
+        input = new HumdrumInput(&m_doc);
+        if (!input->Import(this->GetHumdrumBuffer())) {
             LogError("Error importing Humdrum data (3)");
-            delete tempinput;
+            delete input;
             return false;
         }
-        MEIOutput meioutput(&tempdoc);
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.Export();
-        delete tempinput;
-        input = new MEIInput(&m_doc);
+        isImported = true;
     }
 
     else if (inputFrom == MUSEDATAHUM) {
@@ -716,20 +824,14 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         std::string buffer = conversion.str();
         this->SetHumdrumBuffer(buffer.c_str());
 
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion.str())) {
+        // Now import the Humdrum data directly into the document:
+        input = new HumdrumInput(&m_doc);
+        if (!input->Import(buffer)) {
             LogError("Error importing Humdrum data (4)");
-            delete tempinput;
+            delete input;
             return false;
         }
-        MEIOutput meioutput(&tempdoc);
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.Export();
-        delete tempinput;
-        input = new MEIInput(&m_doc);
+        isImported = true;
     }
 
     else if (inputFrom == ESAC) {
@@ -751,20 +853,14 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
         std::string buffer = conversion.str();
         this->SetHumdrumBuffer(buffer.c_str());
 
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        tempdoc.SetOptions(m_doc.GetOptions());
-        Input *tempinput = new HumdrumInput(&tempdoc);
-        if (!tempinput->Import(conversion.str())) {
+        // Now import the Humdrum data directly into the document:
+        input = new HumdrumInput(&m_doc);
+        if (!input->Import(buffer)) {
             LogError("Error importing Humdrum data (5)");
-            delete tempinput;
+            delete input;
             return false;
         }
-        MEIOutput meioutput(&tempdoc);
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.Export();
-        delete tempinput;
-        input = new MEIInput(&m_doc);
+        isImported = true;
     }
 #endif
     else {
@@ -779,8 +875,20 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
     }
 
     // load the file
-    if (inputFrom != HUMDRUM) {
-        if (!input->Import(newData.size() ? newData : data)) {
+    if (!isImported) {
+        ProfileScope importScope(m_doc.GetProfiler(), "Import");
+        // The converted data and the buffer are ours and can be parsed in place
+        bool imported = false;
+        if (!newData.empty()) {
+            imported = input->ImportInPlace(newData);
+        }
+        else if (buffer) {
+            imported = input->ImportInPlace(*buffer);
+        }
+        else {
+            imported = input->Import(data);
+        }
+        if (!imported) {
             LogError("Error importing data");
             delete input;
             return false;
@@ -788,7 +896,6 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
     }
 
     if (inputFrom == SERIALIZATION) {
-        input->Import(data);
         m_doc.PrepareData();
         m_doc.ScoreDefSetCurrentDoc(true);
         delete input;
@@ -876,6 +983,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
             else if (breaks == BREAKS_smart) {
                 m_doc.CastOffSmartDoc();
             }
+            m_castOffBreaks = breaks;
         }
         else {
             if (breaks == BREAKS_encoded) {
@@ -890,6 +998,7 @@ bool Toolkit::LoadData(const std::string &data, bool resetLogBuffer)
             // LogElapsedTimeStart();
             m_doc.CastOffDoc();
             // LogElapsedTimeEnd("cast-off");
+            m_castOffBreaks = BREAKS_auto;
         }
     }
     else {
@@ -920,6 +1029,7 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
     std::string mdiv;
     bool generateFacs = false;
     bool serialized = false;
+    bool binary = false;
 
     jsonxx::Object json;
 
@@ -944,6 +1054,7 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
             if (json.has<jsonxx::String>("mdiv")) mdiv = json.get<jsonxx::String>("mdiv");
             if (json.has<jsonxx::Boolean>("generateFacs")) generateFacs = json.get<jsonxx::Boolean>("generateFacs");
             if (json.has<jsonxx::Boolean>("serialized")) serialized = json.get<jsonxx::Boolean>("serialized");
+            if (json.has<jsonxx::Boolean>("binary")) binary = json.get<jsonxx::Boolean>("binary");
         }
     }
 
@@ -995,6 +1106,7 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
             return "";
         }
         meioutput.SetSerializing(true);
+        meioutput.SetBinary(binary);
         // Force these flags instead of cumbersome combination checking
         meioutput.SetBasic(false);
         meioutput.SetScoreBasedMEI(false);
@@ -1239,7 +1351,7 @@ bool Toolkit::SetOptions(const std::string &jsonOptions)
         Resources &resources = m_doc.GetResourcesForModification();
         resources.AddCustom(m_options->m_fontAddCustom.GetValue());
     }
-    if (json.has<jsonxx::String>("font")) {
+    if (json.has<jsonxx::String>("font") || json.has<jsonxx::Boolean>("fontPreload")) {
         this->SetFont(m_options->m_font.GetValue());
     }
     if (json.has<jsonxx::String>("fontFallback")) {
@@ -1520,13 +1632,62 @@ std::string Toolkit::EditInfo()
 std::string Toolkit::GetLog()
 {
     std::string str;
-    for (const std::string &logStr : logBuffer) {
-        str += logStr;
+    for (const LogBuffer::Entry &entry : logBuffer.GetEntries()) {
+        str += entry.m_message;
     }
     this->ResetLogBuffer();
     return str;
 }
 
+std::string Toolkit::GetLogEntries()
+{
+    jsonxx::Array entries;
+    for (const LogBuffer::Entry &entry : logBuffer.GetEntries()) {
+        jsonxx::Object o;
+        switch (entry.m_level) {
+            case LOG_ERROR: o << "level" << "error"; break;
+            case LOG_WARNING: o << "level" << "warning"; break;
+            case LOG_INFO: o << "level" << "info"; break;
+            default: o << "level" << "debug"; break;
+        }
+        // Remove the level prefix and the trailing new line added when logging
+        std::string message = entry.m_message;
+        if (!message.empty() && (message.back() == '\n')) message.pop_back();
+        if (!message.empty() && (message.front() == '[')) {
+            const size_t pos = message.find("] ");
+            if (pos != std::string::npos) message.erase(0, pos + 2);
+        }
+        o << "message" << message;
+        o << "count" << entry.m_count;
+        entries << o;
+    }
+    this->ResetLogBuffer();
+    return entries.json();
+}
+
+std::string Toolkit::GetProfile()
+{
+    Profiler profiler;
+    profiler.Append(m_doc.m_profiler);
+    m_doc.m_profiler.Reset();
+    // The MIDI doc can be a separate copy of the doc
+    if (m_midiDoc && (m_midiDoc != &m_doc)) {
+        profiler.Append(m_midiDoc->m_profiler, "MIDI/");
+        m_midiDoc->m_profiler.Reset();
+    }
+
+    jsonxx::Array entries;
+    for (const Profiler::Entry &entry : profiler.GetEntries()) {
+        jsonxx::Object o;
+        o << "path" << entry.m_path;
+        o << "calls" << entry.m_calls;
+        o << "time" << entry.m_milliseconds;
+        if (entry.m_visits > 0) o << "visits" << entry.m_visits;
+        entries << o;
+    }
+    return entries.json();
+}
+
 std::string Toolkit::GetVersion() const
 {
     return vrv::GetVersion();
@@ -1540,7 +1701,7 @@ void Toolkit::ResetXmlIdSeed(int seed)
 
 void Toolkit::ResetLogBuffer()
 {
-    logBuffer.clear();
+    logBuffer.Clear();
 }
 
 void Toolkit::LogRedirectStart()
@@ -1590,6 +1751,8 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
 
     this->ResetLogBuffer();
 
+    ProfileScope profileScope(m_doc.GetProfiler(), "RedoLayout");
+
     if ((this->GetPageCount() == 0) || m_doc.IsTranscription() || m_doc.IsFacs()) {
         LogWarning("No data to re-layout");
         return;
@@ -1604,15 +1767,22 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
 
     if (m_options->m_breaks.GetValue() == BREAKS_line) {
         m_doc.CastOffLineDoc();
+        m_castOffBreaks = BREAKS_line;
     }
     else if (m_options->m_breaks.GetValue() == BREAKS_encoded && m_doc.FindDescendantByType(PB)) {
         m_doc.CastOffEncodingDoc();
+        m_castOffBreaks = BREAKS_encoded;
     }
     else if (m_options->m_breaks.GetValue() == BREAKS_smart) {
         m_doc.CastOffSmartDoc();
+        m_castOffBreaks = BREAKS_smart;
     }
     else if (m_options->m_breaks.GetValue() != BREAKS_none) {
         m_doc.CastOffDoc();
+        m_castOffBreaks = BREAKS_auto;
+    }
+    else {
+        m_castOffBreaks = BREAKS_none;
     }
 }
 
@@ -1658,6 +1828,11 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
         height = m_doc.GetAdjustedDrawingPageHeight();
     }
 
+    // Only a horizontal range of the page is drawn (see Toolkit::RenderToSVGRange)
+    if (m_view.HasDrawingRange()) {
+        width = std::ceil(m_view.GetDrawingRangeWidth() * m_view.GetPPUFactor() / DEFINITION_FACTOR);
+    }
+
     // set dimensions
     if (m_options->m_landscape.GetValue()) {
         std::swap(height, width);
@@ -1700,6 +1875,29 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
 {
     this->ResetLogBuffer();
 
+    return this->RenderPageToSVG(pageNo, xmlDeclaration);
+}
+
+std::string Toolkit::RenderToSVGRange(int pageNo, int x1, int x2, bool xmlDeclaration)
+{
+    this->ResetLogBuffer();
+
+    if (x2 <= x1) {
+        LogWarning("The range to render (%d - %d) is empty", x1, x2);
+        return "";
+    }
+
+    m_view.SetDrawingRange(x1, x2);
+    std::string output = this->RenderPageToSVG(pageNo, xmlDeclaration);
+    m_view.ResetDrawingRange();
+
+    return output;
+}
+
+std::string Toolkit::RenderPageToSVG(int pageNo, bool xmlDeclaration)
+{
+    ProfileScope profileScope(m_doc.GetProfiler(), "RenderToSVG");
+
     // Create the SVG object, h & w come from the system
     // We will need to set the size of the page after having drawn it depending on the options
     SvgDeviceContext svg(m_doc.GetID());
@@ -1741,12 +1939,17 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
     svg.SetHtml5(m_options->m_svgHtml5.GetValue());
     svg.SetFormatRaw(m_options->m_svgFormatRaw.GetValue());
     svg.SetRemoveXlink(m_options->m_svgRemoveXlink.GetValue());
+    svg.SetStream(m_options->m_svgStream.GetValue());
     svg.SetAdditionalAttributes(m_options->m_svgAdditionalAttribute.GetValue());
     svg.SetSmuflTextFont((option_SMUFLTEXTFONT)m_options->m_smuflTextFont.GetValue());
 
     // render the page
-    this->RenderToDeviceContext(pageNo, &svg);
+    {
+        ProfileScope drawScope(m_doc.GetProfiler(), "RenderToDeviceContext");
+        this->RenderToDeviceContext(pageNo, &svg);
+    }
 
+    ProfileScope stringScope(m_doc.GetProfiler(), "GetStringSVG");
     std::string out_str = svg.GetStringSVG(xmlDeclaration);
     return out_str;
 }
@@ -1770,6 +1973,70 @@ bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
     return true;
 }
 
+std::vector<std::string> Toolkit::RenderToSVGPages(int from, int to, int threads, bool xmlDeclaration)
+{
+    this->ResetLogBuffer();
+
+    std::vector<std::string> svgPages;
+    from = std::max(from, 1);
+    to = std::min(to, this->GetPageCount());
+    if (from > to) return svgPages;
+
+    svgPages.resize(to - from + 1);
+    threads = std::min(threads, to - from + 1);
+
+#ifndef __EMSCRIPTEN__
+    if ((threads > 1) && this->CanRenderConcurrently()) {
+        // Drawing a page modifies the doc, so each thread needs its own copy
+        std::vector<std::unique_ptr<Toolkit>> copies;
+        for (int i = 0; i < threads; ++i) {
+            copies.push_back(std::make_unique<Toolkit>(false));
+            this->CopyForRendering(*copies.back());
+        }
+
+        ClassIdsComparison matchType({ PAGE, SYSTEM });
+        ListOfConstObjects layoutObjects;
+        m_doc.FindAllDescendantsByComparison(&layoutObjects, &matchType);
+
+        std::atomic<int> nextPageNo = from;
+        std::atomic<bool> layoutMismatch = false;
+        std::vector<std::thread> workers;
+        // The log buffer is per thread, so the one of each worker is passed back
+        std::vector<LogBuffer> workerLogs(copies.size());
+        for (int i = 0; i < (int)copies.size(); ++i) {
+            workers.emplace_back([&, i, toolkit = copies.at(i).get()]() {
+                if (!toolkit->LayOutCopy(layoutObjects, m_castOffBreaks)) {
+                    layoutMismatch = true;
+                }
+                for (int pageNo = nextPageNo++; pageNo <= to && !layoutMismatch; pageNo = nextPageNo++) {
+                    svgPages.at(pageNo - from) = toolkit->RenderPageToSVG(pageNo, xmlDeclaration);
+                }
+                workerLogs.at(i) = std::move(logBuffer);
+            });
+        }
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+        for (LogBuffer &workerLog : workerLogs) {
+            logBuffer.Append(std::move(workerLog));
+        }
+        // Times of the copies are summed up over the threads
+        for (std::unique_ptr<Toolkit> &copy : copies) {
+            m_doc.m_profiler.Append(copy->m_doc.m_profiler);
+        }
+
+        if (!layoutMismatch) return svgPages;
+        LogWarning("The layout of the copied document does not match, pages are rendered sequentially");
+    }
+#endif
+
+    for (int pageNo = from; pageNo <= to; ++pageNo) {
+        svgPages.at(pageNo - from) = this->RenderPageToSVG(pageNo, xmlDeclaration);
+    }
+
+    return svgPages;
+}
+
 std::string Toolkit::GetHumdrum()
 {
     return this->GetHumdrumBuffer();
@@ -1891,65 +2158,63 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     this->ResetLogBuffer();
 
     jsonxx::Object o;
-    jsonxx::Array noteArray;
-    jsonxx::Array chordArray;
-    jsonxx::Array restArray;
 
     assert(m_midiDoc);
-    // Here we need to check that the MIDI timemap is done
-    if (!m_midiDoc->HasTimemap()) {
-        // generate MIDI timemap before progressing
-        m_midiDoc->CalculateTimemap();
-    }
+    const TimemapIndex &timemapIndex = m_midiDoc->GetTimemapIndex();
 
-    MeasureOnsetOffsetComparison matchMeasureTime(millisec);
-    Measure *measure = dynamic_cast<Measure *>(m_midiDoc->FindDescendantByComparison(&matchMeasureTime));
-
-    if (!measure) {
-        return o.json();
+    TimemapElements elements;
+    if (timemapIndex.GetElementsAtTime(millisec, elements)) {
+        this->ElementsToJson(elements, o);
     }
 
-    int repeat = measure->EnclosesTime(millisec);
-    int measureTimeOffset = measure->GetRealTimeOnsetMilliseconds(repeat);
+    return o.json();
+}
 
-    // Get the pageNo from the first note (if any)
-    int pageNo = -1;
-    Page *page = vrv_cast<Page *>(measure->GetFirstAncestor(PAGE));
-    if (page) pageNo = page->GetIdx() + 1;
+std::string Toolkit::GetElementsAtTimeRange(int millisecStart, int millisecEnd)
+{
+    this->SetMidiDoc();
+    this->ResetLogBuffer();
 
-    NoteOrRestOnsetOffsetComparison matchTime(millisec - measureTimeOffset);
-    ListOfObjects notesOrRests;
-    ListOfObjects chords;
+    jsonxx::Array changes;
 
-    measure->FindAllDescendantsByComparison(&notesOrRests, &matchTime);
-    ClassIdsComparison mRestComparison({ MULTIREST, MREST });
-    measure->FindAllDescendantsByComparison(&notesOrRests, &mRestComparison, UNLIMITED_DEPTH, FORWARD, false);
+    assert(m_midiDoc);
+    const TimemapIndex &timemapIndex = m_midiDoc->GetTimemapIndex();
 
-    // Fill the JSON object
-    for (Object *object : notesOrRests) {
-        if (object->Is(NOTE)) {
-            noteArray << object->GetID();
-            Note *note = vrv_cast<Note *>(object);
-            assert(note);
-            Chord *chord = note->IsChordTone();
-            if (chord) chords.push_back(chord);
+    for (int time : timemapIndex.GetChangeTimes(millisecStart, millisecEnd)) {
+        jsonxx::Object o;
+        o << "time" << time;
+        TimemapElements elements;
+        if (timemapIndex.GetElementsAtTime(time, elements)) {
+            this->ElementsToJson(elements, o);
         }
-        else if (object->Is({ MREST, MULTIREST, REST })) {
-            restArray << object->GetID();
-        }
-    }
-    chords.unique();
-    for (Object *object : chords) {
-        chordArray << object->GetID();
+        changes << o;
     }
 
+    return changes.json();
+}
+
+void Toolkit::ElementsToJson(const TimemapElements &elements, jsonxx::Object &o)
+{
+    assert(m_midiDoc);
+
+    jsonxx::Array noteArray;
+    jsonxx::Array chordArray;
+    jsonxx::Array restArray;
+    for (const std::string &id : elements.notes) noteArray << id;
+    for (const std::string &id : elements.chords) chordArray << id;
+    for (const std::string &id : elements.rests) restArray << id;
+
+    // Get the pageNo from the measure
+    int pageNo = -1;
+    Object *measure = m_midiDoc->FindDescendantByID(elements.measure);
+    Page *page = (measure) ? vrv_cast<Page *>(measure->GetFirstAncestor(PAGE)) : NULL;
+    if (page) pageNo = page->GetIdx() + 1;
+
     o << "notes" << noteArray;
     o << "chords" << chordArray;
     o << "rests" << restArray;
     o << "page" << pageNo;
-    o << "measure" << measure->GetID();
-
-    return o.json();
+    o << "measure" << elements.measure;
 }
 
 bool Toolkit::RenderToMIDIFile(const std::string &filename)
@@ -2280,28 +2545,7 @@ std::string Toolkit::ConvertHumdrumToHumdrum(const std::string &humdrumData)
         return "";
     }
 
-    // Apply Humdrum tools if there are any filters in the file.
-    hum::Tool_filter filter;
-    for (int i = 0; i < infiles.getCount(); ++i) {
-        if (infiles[i].hasGlobalFilters()) {
-            filter.run(infiles[i]);
-            if (filter.hasHumdrumText()) {
-                infiles[i].readString(filter.getHumdrumText());
-            }
-            else {
-                // should have auto updated itself in the filter.
-            }
-        }
-    }
-
-    // Apply Humdrum tools to the entire set if they are
-    // at the universal level.
-    if (infiles.hasUniversalFilters()) {
-        filter.runUniversal(infiles);
-        if (filter.hasHumdrumText()) {
-            infiles.readString(filter.getHumdrumText());
-        }
-    }
+    HumdrumInput::ApplyFilters(infiles);
 
     hum::HumdrumFile &infile = infiles[0];
     std::stringstream humout;
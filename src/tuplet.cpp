@@ -101,6 +101,7 @@ bool Tuplet::AddChild(Object *child)
         children.push_back(child);
     }
 
+    this->IndexChild(child);
     this->Modify();
 
     return true;
@@ -32,6 +32,8 @@ View::View()
     m_slurHandling = SlurHandling::Initialize;
 
     m_currentColor = COLOR_NONE;
+
+    this->ResetDrawingRange();
 }
 
 View::~View() {}
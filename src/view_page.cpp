@@ -90,7 +90,10 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     dc->DrawBackgroundImage();
 
     Point origin = dc->GetLogicalOrigin();
-    dc->SetLogicalOrigin(origin.x - m_doc->m_drawingPageMarginLeft, origin.y - m_doc->m_drawingPageMarginTop);
+    // With a drawing range, shift the origin to its left edge
+    const int rangeX = (this->HasDrawingRange()) ? m_drawingRangeX1 : 0;
+    dc->SetLogicalOrigin(
+        origin.x - m_doc->m_drawingPageMarginLeft + rangeX, origin.y - m_doc->m_drawingPageMarginTop);
 
     dc->StartPage();
 
@@ -122,6 +125,18 @@ double View::GetPPUFactor() const
     return m_currentPage->GetPPUFactor();
 }
 
+void View::SetDrawingRange(int x1, int x2)
+{
+    m_drawingRangeX1 = x1;
+    m_drawingRangeX2 = x2;
+}
+
+void View::ResetDrawingRange()
+{
+    m_drawingRangeX1 = VRV_UNSET;
+    m_drawingRangeX2 = VRV_UNSET;
+}
+
 void View::SetScoreDefDrawingWidth(DeviceContext *dc, ScoreDef *scoreDef)
 {
     assert(dc);
@@ -990,6 +1005,26 @@ void View::DrawBarLineDots(DeviceContext *dc, Staff *staff, BarLine *barLine)
 // View - Measure
 //----------------------------------------------------------------------------
 
+bool View::IsInDrawingRange(const Measure *measure) const
+{
+    assert(measure);
+
+    if (!this->HasDrawingRange()) return true;
+
+    int left = measure->GetDrawingX();
+    int right = left + measure->GetWidth();
+    // Include what sticks out of the measure (e.g., text or lyrics) when the bounding box is available
+    if (measure->HasContentHorizontalBB()) {
+        left = std::min(left, measure->GetContentLeft());
+        right = std::max(right, measure->GetContentRight());
+    }
+    // The range includes the left margin of the page
+    left += m_doc->m_drawingPageMarginLeft;
+    right += m_doc->m_drawingPageMarginLeft;
+
+    return ((right >= m_drawingRangeX1) && (left <= m_drawingRangeX2));
+}
+
 void View::DrawMeasure(DeviceContext *dc, Measure *measure, System *system)
 {
     assert(dc);
@@ -1692,7 +1727,8 @@ void View::DrawSystemChildren(DeviceContext *dc, Object *parent, System *system)
     for (Object *current : parent->GetChildren()) {
         if (current->Is(MEASURE)) {
             // cast to Measure check in DrawMeasure
-            this->DrawMeasure(dc, vrv_cast<Measure *>(current), system);
+            Measure *measure = vrv_cast<Measure *>(current);
+            if (this->IsInDrawingRange(measure)) this->DrawMeasure(dc, measure, system);
         }
         // scoreDef are not drawn directly, but anything else should not be possible
         else if (current->Is(SCOREDEF)) {
@@ -1701,7 +1737,7 @@ void View::DrawSystemChildren(DeviceContext *dc, Object *parent, System *system)
             assert(scoreDef);
 
             Measure *nextMeasure = vrv_cast<Measure *>(system->GetNext(scoreDef, MEASURE));
-            if (nextMeasure && scoreDef->DrawLabels()) {
+            if (nextMeasure && scoreDef->DrawLabels() && this->IsInDrawingRange(nextMeasure)) {
                 ScoreDef *scoreDefToDraw = scoreDef;
                 bool noLabels = false;
                 // If we have an emprty scoreDef after a section with `@restart="true"`
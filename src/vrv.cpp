@@ -18,6 +18,10 @@
 #include <sstream>
 #include <vector>
 
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
 #ifndef _WIN32
 #include <dirent.h>
 #else
@@ -66,12 +70,12 @@ namespace vrv {
 struct timeval start;
 
 /** For controlling the log level - warning level enabled by default */
-LogLevel logLevel = LOG_WARNING;
+std::atomic<LogLevel> logLevel = LOG_WARNING;
 
 /** By default log to stderr or JS console */
-bool loggingToBuffer = false;
+std::atomic<bool> loggingToBuffer = false;
 
-std::vector<std::string> logBuffer;
+thread_local LogBuffer logBuffer;
 
 void LogElapsedTimeStart()
 {
@@ -88,6 +92,120 @@ void LogElapsedTimeStop(const char *msg)
     LogInfo("Elapsed time (%s): %.3fs", msg, elapsedTime / 1000);
 }
 
+//----------------------------------------------------------------------------
+// Profiler
+//----------------------------------------------------------------------------
+
+thread_local Profiler *Profiler::s_active = NULL;
+
+void Profiler::Enter(const char *name)
+{
+    const int parent = (m_frames.empty()) ? VRV_UNSET : m_frames.back().m_index;
+    std::unordered_map<const char *, int> &children = (parent == VRV_UNSET) ? m_topChildren : m_children.at(parent);
+    auto iter = children.find(name);
+    int index;
+    if (iter != children.end()) {
+        index = iter->second;
+    }
+    else {
+        // The same path can be reached with another pointer for the name
+        std::string path = (parent == VRV_UNSET) ? name : m_entries.at(parent).m_path + "/" + name;
+        auto [pathIter, inserted] = m_indices.try_emplace(path, (int)m_entries.size());
+        if (inserted) {
+            Entry entry;
+            entry.m_path = std::move(path);
+            m_entries.push_back(std::move(entry));
+            m_children.push_back({});
+        }
+        index = pathIter->second;
+        // Look up the children again since adding an entry can move them
+        ((parent == VRV_UNSET) ? m_topChildren : m_children.at(parent))[name] = index;
+    }
+    m_frames.push_back({ index, std::chrono::steady_clock::now() });
+}
+
+void Profiler::Leave(long visits)
+{
+    assert(!m_frames.empty());
+
+    const Frame &frame = m_frames.back();
+    Entry &entry = m_entries.at(frame.m_index);
+    ++entry.m_calls;
+    entry.m_milliseconds
+        += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frame.m_start).count();
+    entry.m_visits += visits;
+    m_frames.pop_back();
+}
+
+void Profiler::Append(const Profiler &other, const std::string &prefix)
+{
+    for (const Entry &otherEntry : other.m_entries) {
+        auto [iter, inserted] = m_indices.try_emplace(prefix + otherEntry.m_path, (int)m_entries.size());
+        if (inserted) {
+            Entry entry;
+            entry.m_path = iter->first;
+            m_entries.push_back(std::move(entry));
+            m_children.push_back({});
+        }
+        Entry &entry = m_entries.at(iter->second);
+        entry.m_calls += otherEntry.m_calls;
+        entry.m_milliseconds += otherEntry.m_milliseconds;
+        entry.m_visits += otherEntry.m_visits;
+    }
+}
+
+void Profiler::Reset()
+{
+    // Phases currently entered are kept
+    if (!m_frames.empty()) return;
+
+    m_entries.clear();
+    m_indices.clear();
+    m_children.clear();
+    m_topChildren.clear();
+}
+
+const std::string &Profiler::GetTypeName(const std::type_info &type)
+{
+    auto [iter, inserted] = m_typeNames.try_emplace(type);
+    if (!inserted) return iter->second;
+
+    std::string &name = iter->second;
+    name = type.name();
+#if defined(__GNUG__)
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(type.name(), NULL, NULL, &status);
+    if (status == 0) name = demangled;
+    free(demangled);
+#endif
+    const size_t pos = name.rfind("::");
+    if (pos != std::string::npos) name.erase(0, pos + 2);
+    return name;
+}
+
+//----------------------------------------------------------------------------
+// ProfileScope
+//----------------------------------------------------------------------------
+
+ProfileScope::ProfileScope(Profiler *profiler, const char *name)
+{
+    m_profiler = profiler;
+    m_previous = NULL;
+    if (!m_profiler) return;
+
+    m_previous = Profiler::s_active;
+    Profiler::s_active = m_profiler;
+    m_profiler->Enter(name);
+}
+
+ProfileScope::~ProfileScope()
+{
+    if (!m_profiler) return;
+
+    m_profiler->Leave();
+    Profiler::s_active = m_previous;
+}
+
 void LogDebug(const char *fmt, ...)
 {
     if (logLevel < LOG_DEBUG) return;
@@ -141,8 +259,7 @@ void LogWarning(const char *fmt, ...)
 void LogString(std::string message, LogLevel level)
 {
     if (loggingToBuffer) {
-        if (LogBufferContains(message)) return;
-        logBuffer.push_back(message);
+        logBuffer.Add(std::move(message), level);
     }
     else {
 #ifdef __EMSCRIPTEN__
@@ -181,7 +298,42 @@ LogLevel StrToLogLevel(const std::string &level)
 
 bool LogBufferContains(const std::string &s)
 {
-    return (std::find(logBuffer.cbegin(), logBuffer.cend(), s) != logBuffer.cend());
+    return logBuffer.Contains(s);
+}
+
+//----------------------------------------------------------------------------
+// LogBuffer
+//----------------------------------------------------------------------------
+
+void LogBuffer::Add(std::string &&message, LogLevel level)
+{
+    auto [iter, inserted] = m_indices.try_emplace(message, (int)m_entries.size());
+    if (inserted) {
+        m_entries.push_back({ level, std::move(message), 1 });
+    }
+    else {
+        ++m_entries.at(iter->second).m_count;
+    }
+}
+
+void LogBuffer::Append(LogBuffer &&other)
+{
+    for (Entry &entry : other.m_entries) {
+        auto [iter, inserted] = m_indices.try_emplace(entry.m_message, (int)m_entries.size());
+        if (inserted) {
+            m_entries.push_back(std::move(entry));
+        }
+        else {
+            m_entries.at(iter->second).m_count += entry.m_count;
+        }
+    }
+    other.Clear();
+}
+
+void LogBuffer::Clear()
+{
+    m_entries.clear();
+    m_indices.clear();
 }
 
 //----------------------------------------------------------------------------
@@ -106,6 +106,13 @@ const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getElementsAtTimeRange(void *tkPtr, int millisecStart, int millisecEnd)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetElementsAtTimeRange(millisecStart, millisecEnd));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getExpansionIdsForElement(void *tkPtr, const char *xmlId)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -163,6 +170,20 @@ const char *vrvToolkit_getLog(void *tkPtr)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getLogEntries(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetLogEntries());
+    return tk->GetCString();
+}
+
+const char *vrvToolkit_getProfile(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetProfile());
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getMEI(void *tkPtr, const char *options)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -332,6 +353,13 @@ const char *vrvToolkit_renderToSVG(void *tkPtr, int page_no, bool xmlDeclaration
     return tk->GetCString();
 }
 
+const char *vrvToolkit_renderToSVGRange(void *tkPtr, int page_no, int x1, int x2, bool xmlDeclaration)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RenderToSVGRange(page_no, x1, x2, xmlDeclaration));
+    return tk->GetCString();
+}
+
 bool vrvToolkit_renderToSVGFile(void *tkPtr, const char *filename, int pageNo)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
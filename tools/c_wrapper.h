@@ -28,6 +28,7 @@ const char *vrvToolkit_getDefaultOptions(void *tkPtr);
 const char *vrvToolkit_getDescriptiveFeatures(void *tkPtr, const char *options);
 const char *vrvToolkit_getElementAttr(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec);
+const char *vrvToolkit_getElementsAtTimeRange(void *tkPtr, int millisecStart, int millisecEnd);
 const char *vrvToolkit_getExpansionIdsForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getHumdrum(void *tkPtr);
 bool vrvToolkit_getHumdrumFile(void *tkPtr, const char *filename);
@@ -36,6 +37,8 @@ const char *vrvToolkit_convertHumdrumToHumdrum(void *tkPtr, const char *humdrumD
 const char *vrvToolkit_convertHumdrumToMIDI(void *tkPtr, const char *humdrumData);
 const char *vrvToolkit_convertMEIToHumdrum(void *tkPtr, const char *meiData);
 const char *vrvToolkit_getLog(void *tkPtr);
+const char *vrvToolkit_getLogEntries(void *tkPtr);
+const char *vrvToolkit_getProfile(void *tkPtr);
 const char *vrvToolkit_getMEI(void *tkPtr, const char *options);
 const char *vrvToolkit_getMIDIValuesForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getNotatedIdForElement(void *tkPtr, const char *xmlId);
@@ -62,6 +65,7 @@ bool vrvToolkit_renderToMIDIFile(void *tkPtr, const char *filename);
 const char *vrvToolkit_renderToPAE(void *tkPtr);
 bool vrvToolkit_renderToPAEFile(void *tkPtr, const char *filename);
 const char *vrvToolkit_renderToSVG(void *tkPtr, int page_no, bool xmlDeclaration);
+const char *vrvToolkit_renderToSVGRange(void *tkPtr, int page_no, int x1, int x2, bool xmlDeclaration);
 bool vrvToolkit_renderToSVGFile(void *tkPtr, const char *filename, int pageNo);
 const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options);
 bool vrvToolkit_renderToTimemapFile(void *tkPtr, const char *filename, const char *c_options);
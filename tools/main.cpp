@@ -282,11 +282,11 @@ int main(int argc, char **argv)
     }
 
     const std::vector<std::string> outformats = { "mei", "mei-basic", "mei-pb", "mei-facs", "svg", "midi", "timemap",
-        "expansionmap", "humdrum", "hum", "pae", "mei-pb-serialized" };
+        "expansionmap", "humdrum", "hum", "pae", "mei-pb-serialized", "mei-pb-binary" };
     if (std::find(outformats.begin(), outformats.end(), outformat) == outformats.end()) {
         std::cerr << "Output format (" << outformat
                   << ") can only be 'mei', 'mei-basic', 'mei-pb', mei-facs', 'svg', 'midi', 'timemap', 'expansionmap', "
-                     "'humdrum', 'hum', 'pae', or , 'mei-pb-serialized'."
+                     "'humdrum', 'hum', 'pae', 'mei-pb-serialized', or 'mei-pb-binary'."
                   << std::endl;
         exit(1);
     }
@@ -351,13 +351,31 @@ int main(int argc, char **argv)
         const int from = page ? *page : 1;
         const int to = allPages ? toolkit.GetPageCount() : from;
 
+        // Render the pages concurrently before writing them
+        std::vector<std::string> svgPages;
+        if ((options->m_threads.GetValue() > 1) && (from < to)) {
+            svgPages = toolkit.RenderToSVGPages(from, to, options->m_threads.GetValue(), !stdOutput);
+        }
+
         for (int p = from; p <= to; ++p) {
             std::string curOutfile = outfile;
             if (from < to) {
                 curOutfile += vrv::StringFormat("_%03d", p);
             }
             curOutfile += ".svg";
-            if (stdOutput) {
+            if (!svgPages.empty()) {
+                if (stdOutput) {
+                    std::cout << svgPages.at(p - from);
+                    continue;
+                }
+                std::ofstream svgFile(curOutfile.c_str());
+                if (!svgFile.is_open() || !(svgFile << svgPages.at(p - from))) {
+                    std::cerr << "Unable to write SVG to " << curOutfile << "." << std::endl;
+                    exit(1);
+                }
+                std::cerr << "Output written to " << curOutfile << "." << std::endl;
+            }
+            else if (stdOutput) {
                 std::cout << toolkit.RenderToSVG(p);
             }
             else if (!toolkit.RenderToSVGFile(curOutfile, p)) {
@@ -554,6 +572,10 @@ int main(int argc, char **argv)
             params = "{'serialized': true }";
             outfile += ".xml";
         }
+        else if (outformat == "mei-pb-binary") {
+            params = "{'serialized': true, 'binary': true }";
+            outfile += ".bin";
+        }
         else {
             const char *scoreBased = (outformat == "mei-pb") ? "false" : "true";
             const char *basic = (outformat == "mei-basic") ? "true" : "false";
@@ -583,5 +605,10 @@ int main(int argc, char **argv)
         toolkit.LogRuntime();
     }
 
+    // Display the profile if desired
+    if (options->m_profile.GetValue()) {
+        std::cerr << toolkit.GetProfile() << std::endl;
+    }
+
     return 0;
 }